@@ -57,6 +57,14 @@
 
 
 
+// Functions used to hash data and to fingerprint
+// it cheaply, used to check that an index or a
+// cache saved to a file still matches its data
+
+#include "blDataFingerprint.hpp"
+
+
+
 // Cyclic versions of common stl-algorithms such
 // as std::copy and std::find but with a parameter
 // that allows a user to specify the maximum
@@ -77,6 +85,25 @@
 
 
 
+// A scanner that classifies 64 bytes at a time against
+// a list of tokens using SSE2/AVX2 (with a scalar fallback),
+// and overloads of "countDataRows" and
+// "findBeginningOfNthDataPoint" (and their quote-aware
+// versions) that use it when the data is a contiguous
+// char buffer
+
+#include "blSIMDTokenScanner.hpp"
+
+
+
+// A set of tokens stored as a 256-bit membership table,
+// and overloads of "find_first_of" and "find_first_not_of"
+// that take it instead of a list of tokens
+
+#include "blTokenSet.hpp"
+
+
+
 // Function used to convert a sequence of characters
 // into a floating point number.
 // The function accepts "begin" and "end" iterators
@@ -96,6 +123,38 @@
 
 
 
+// The layout of csv data (tokens, dimensions, column
+// names and indexes) shared between copies of the
+// csv matrix iterator
+
+#include "blCSVMatrixLayout.hpp"
+
+
+
+// Typed csv columns (int32, int64, float, double or
+// categorical strings) and the inference of a column's
+// type from the text of its values
+
+#include "blCSVTypedColumn.hpp"
+
+
+
+// Statistics of a column of values (count, NaN count,
+// min, max, mean, variance and distinct count estimate)
+// computed in one pass and mergeable across threads
+
+#include "blColumnStatistics.hpp"
+
+
+
+// Lightweight view of one data row of csv data,
+// holding the offsets of its fields and converting
+// them only when they are accessed
+
+#include "blCSVRowView.hpp"
+
+
+
 // Custom iterator useful in parsing data from csv files
 // and making it addressable like a numeric matrix
 
@@ -103,6 +162,14 @@
 
 
 
+// Forward-only iterator that streams numbers out
+// of csv data in a single pass, without counting
+// its rows first
+
+#include "blCSVStreamIterator.hpp"
+
+
+
 // Custom iterator useful in parsing serialized data
 // from generic text-data streams (for ex. files) and
 // turn it into a numeric matrix
@@ -174,6 +241,34 @@
 
 
 
+// Parses a csv file once into a binary sidecar file
+// (in the format read by the binary matrix iterator)
+// that later opens map directly, as long as the csv
+// file has not changed
+
+#include "blCSVBinaryCache.hpp"
+
+
+
+// A read-only memory-mapped file whose
+// "const char*" begin/end iterators can be
+// handed straight to the matrix iterators
+// above, with optional access hints and
+// huge pages
+
+#include "blMappedFile.hpp"
+
+
+
+// Streams the decompressed contents of a gzip or
+// zstd compressed file (decompressed on a separate
+// thread) in chunks of whole rows that can be
+// handed to the matrix iterators above
+
+#include "blDecompressingSource.hpp"
+
+
+
 // Functions that calculate the page number of a string
 // and the corresponding string from a given page number
 //
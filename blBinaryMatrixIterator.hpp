@@ -55,6 +55,12 @@
 //                     are of the same type (the type specified by the user through
 //                     the template parameter)
 //
+//                  -- The next N values (in the advancing order) can be read in
+//                     one call, which copies them straight from the data when
+//                     advancing in a column-major way, and otherwise walks the
+//                     rows, columns and pages without recomputing them from the
+//                     index for every value
+//
 //                  -- This class and its functions are defined within
 //                     the "blAlgorithmsLIB" namespace
 //
@@ -77,6 +83,8 @@
 //-------------------------------------------------------------------
 #include <iterator>
 #include <iostream>
+#include <type_traits>
+#include <algorithm>
 //-------------------------------------------------------------------
 
 
@@ -101,12 +109,17 @@ public: // Type aliases
 
 
     // Iterator traits
+    // The pointer and reference types are
+    // const when the data is read-only (for
+    // ex. a memory-mapped file)
 
     using iterator_category = std::random_access_iterator_tag;
     using value_type = blNumberType;
     using difference_type = std::ptrdiff_t;
-    using pointer = blNumberType*;
-    using reference = blNumberType&;
+    using pointer = typename std::conditional<std::is_const<typename std::remove_reference<typename std::iterator_traits<blDataIteratorType>::reference>::type>::value,
+                                              const blNumberType*,
+                                              blNumberType*>::type;
+    using reference = typename std::iterator_traits<pointer>::reference;
 
 
 
@@ -163,8 +176,8 @@ public: // Reference and Dereference operators
 
 
 
-    blNumberType*                                                       operator->();
-    blNumberType&                                                       operator*();
+    pointer                                                             operator->();
+    reference                                                           operator*();
     const blNumberType&                                                 operator*()const;
 
 
@@ -176,9 +189,9 @@ public: // Access operators
     // Access operators treating the data
     // as a one-dimensional data buffer
 
-    blNumberType&                                                       operator[](const std::ptrdiff_t& index);
-    blNumberType&                                                       operator()(const std::ptrdiff_t& index);
-    blNumberType&                                                       at(const std::ptrdiff_t& index);
+    reference                                                           operator[](const std::ptrdiff_t& index);
+    reference                                                           operator()(const std::ptrdiff_t& index);
+    reference                                                           at(const std::ptrdiff_t& index);
 
     const blNumberType&                                                 operator[](const std::ptrdiff_t& index)const;
     const blNumberType&                                                 operator()(const std::ptrdiff_t& index)const;
@@ -189,9 +202,9 @@ public: // Access operators
     // Access operators treating the data
     // as a two-dimensional data buffer
 
-    blNumberType&                                                       operator()(const std::ptrdiff_t& rowIndex,
+    reference                                                           operator()(const std::ptrdiff_t& rowIndex,
                                                                                    const std::ptrdiff_t& colIndex);
-    blNumberType&                                                       at(const std::ptrdiff_t& rowIndex,
+    reference                                                           at(const std::ptrdiff_t& rowIndex,
                                                                            const std::ptrdiff_t& colIndex);
 
     const blNumberType&                                                 operator()(const std::ptrdiff_t& rowIndex,
@@ -204,10 +217,10 @@ public: // Access operators
     // Access operators treating the data
     // as a three-dimensional data buffer
 
-    blNumberType&                                                       operator()(const std::ptrdiff_t& rowIndex,
+    reference                                                           operator()(const std::ptrdiff_t& rowIndex,
                                                                                    const std::ptrdiff_t& colIndex,
                                                                                    const std::ptrdiff_t& pageIndex);
-    blNumberType&                                                       at(const std::ptrdiff_t& rowIndex,
+    reference                                                           at(const std::ptrdiff_t& rowIndex,
                                                                            const std::ptrdiff_t& colIndex,
                                                                            const std::ptrdiff_t& pageIndex);
 
@@ -255,6 +268,19 @@ public: // Public functions
 
 
 
+    // Function used to read the next values
+    // (starting with the current one) in the
+    // advancing order into the output iterator
+    // and to move the iterator past them
+    // It stops at the end of the data and
+    // returns the number of values read
+
+    template<typename blOutputIteratorType>
+    std::size_t                                                         fill(blOutputIteratorType outputIter,
+                                                                             const std::size_t& numberOfValues);
+
+
+
     // Overloaded arithmetic operators
 
     blBinaryMatrixIterator<blDataIteratorType,blNumberType>&            operator+=(const std::ptrdiff_t& movement);
@@ -509,11 +535,11 @@ inline void blBinaryMatrixIterator<blDataIteratorType,blNumberType>::setIterator
     {
         // First we read the serial number, rows and cols
 
-        m_serialNumber = static_cast<std::ptrdiff_t>( *(reinterpret_cast<blNumberType*>(&(*m_iter))) );
+        m_serialNumber = static_cast<std::ptrdiff_t>( *(reinterpret_cast<const blNumberType*>(&(*m_iter))) );
         m_iter += sizeof(blNumberType);
-        m_rows = static_cast<std::size_t>( *(reinterpret_cast<blNumberType*>(&(*m_iter))) );
+        m_rows = static_cast<std::size_t>( *(reinterpret_cast<const blNumberType*>(&(*m_iter))) );
         m_iter += sizeof(blNumberType);
-        m_cols = static_cast<std::size_t>( *(reinterpret_cast<blNumberType*>(&(*m_iter))) );
+        m_cols = static_cast<std::size_t>( *(reinterpret_cast<const blNumberType*>(&(*m_iter))) );
         m_iter += sizeof(blNumberType);
 
 
@@ -957,6 +983,173 @@ inline void blBinaryMatrixIterator<blDataIteratorType,blNumberType>::moveIterato
 
 
 
+//-------------------------------------------------------------------
+// Function used to read the next values in the
+// advancing order in one call
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType>
+
+template<typename blOutputIteratorType>
+
+inline std::size_t blBinaryMatrixIterator<blDataIteratorType,blNumberType>::fill(blOutputIteratorType outputIter,
+                                                                                 const std::size_t& numberOfValues)
+{
+    std::ptrdiff_t size = static_cast<std::ptrdiff_t>(m_size);
+
+    if(m_currentIndex < 0 || m_currentIndex >= size)
+        return 0;
+
+
+
+    const blNumberType* data = reinterpret_cast<const blNumberType*>(&(*m_beginIter)) + 3;
+
+    std::ptrdiff_t rows = static_cast<std::ptrdiff_t>(m_rows);
+    std::ptrdiff_t cols = static_cast<std::ptrdiff_t>(m_cols);
+    std::ptrdiff_t pages = static_cast<std::ptrdiff_t>(m_pages);
+    std::ptrdiff_t rowsTimesCols = rows * cols;
+
+    std::ptrdiff_t index = m_currentIndex;
+    std::ptrdiff_t row = m_currentRow;
+    std::ptrdiff_t col = m_currentCol;
+    std::ptrdiff_t page = m_currentPage;
+
+    std::size_t numberOfValuesRead = 0;
+
+    bool hasReachedTheEnd = false;
+
+
+
+    // The row, column and page are walked
+    // along with the index, so that moving
+    // to the next value does not need any
+    // division
+
+    switch(m_advancingIteratorMethod)
+    {
+    default:
+    case COL_MAJOR:
+
+        // The values are stored in this
+        // order, so we copy them in one go
+
+        numberOfValuesRead = std::min(numberOfValues,static_cast<std::size_t>(size - index));
+
+        std::copy_n(data + index,numberOfValuesRead,outputIter);
+
+        index += static_cast<std::ptrdiff_t>(numberOfValuesRead);
+
+        hasReachedTheEnd = (index >= size);
+
+        break;
+
+
+
+    case ROW_MAJOR:
+
+        while(numberOfValuesRead < numberOfValues && !hasReachedTheEnd)
+        {
+            (*outputIter) = data[index];
+            ++outputIter;
+            ++numberOfValuesRead;
+
+            ++col;
+            index += rows;
+
+            if(col == cols)
+            {
+                col = 0;
+                ++row;
+                index -= rowsTimesCols - 1;
+
+                if(row == rows)
+                {
+                    row = 0;
+                    ++page;
+                    index += rowsTimesCols - rows;
+
+                    hasReachedTheEnd = (page == pages);
+                }
+            }
+        }
+
+        break;
+
+
+
+    case COL_PAGE_MAJOR:
+
+        while(numberOfValuesRead < numberOfValues && !hasReachedTheEnd)
+        {
+            (*outputIter) = data[index];
+            ++outputIter;
+            ++numberOfValuesRead;
+
+            ++row;
+            ++index;
+
+            if(row == rows)
+            {
+                row = 0;
+                ++page;
+                index += rowsTimesCols - rows;
+
+                if(page == pages)
+                {
+                    page = 0;
+                    ++col;
+                    index = col * rows;
+
+                    hasReachedTheEnd = (col == cols);
+                }
+            }
+        }
+
+        break;
+
+
+
+    case ROW_PAGE_MAJOR:
+
+        // Same wrapping around as when
+        // moving the iterator
+
+        while(numberOfValuesRead < numberOfValues && !hasReachedTheEnd)
+        {
+            (*outputIter) = data[index];
+            ++outputIter;
+            ++numberOfValuesRead;
+
+            index += rows;
+
+            if(index >= size + rows - 1)
+                hasReachedTheEnd = true;
+            else if(index >= size)
+                index = index % size + 1;
+        }
+
+        break;
+    }
+
+
+
+    // Finally we move the iterator
+    // past the values read
+
+    if(hasReachedTheEnd)
+        this->moveToTheEnd();
+    else if(m_advancingIteratorMethod == ROW_MAJOR ||
+            m_advancingIteratorMethod == COL_PAGE_MAJOR)
+        this->moveToPosition(row,col,page);
+    else
+        this->moveToPosition(index);
+
+    return numberOfValuesRead;
+}
+//-------------------------------------------------------------------
+
+
+
 //-------------------------------------------------------------------
 // Overloaded arithmetic operators
 //-------------------------------------------------------------------
@@ -1085,9 +1278,9 @@ inline std::ptrdiff_t blBinaryMatrixIterator<blDataIteratorType,blNumberType>::o
 template<typename blDataIteratorType,
          typename blNumberType>
 
-inline blNumberType* blBinaryMatrixIterator<blDataIteratorType,blNumberType>::operator->()
+inline typename blBinaryMatrixIterator<blDataIteratorType,blNumberType>::pointer blBinaryMatrixIterator<blDataIteratorType,blNumberType>::operator->()
 {
-    return reinterpret_cast<blNumberType*>(m_iter);
+    return reinterpret_cast<pointer>(&(*m_iter));
 }
 
 
@@ -1095,9 +1288,9 @@ inline blNumberType* blBinaryMatrixIterator<blDataIteratorType,blNumberType>::op
 template<typename blDataIteratorType,
          typename blNumberType>
 
-inline blNumberType& blBinaryMatrixIterator<blDataIteratorType,blNumberType>::operator*()
+inline typename blBinaryMatrixIterator<blDataIteratorType,blNumberType>::reference blBinaryMatrixIterator<blDataIteratorType,blNumberType>::operator*()
 {
-    return (*reinterpret_cast<blNumberType*>(m_iter));
+    return (*reinterpret_cast<pointer>(&(*m_iter)));
 }
 
 
@@ -1107,7 +1300,7 @@ template<typename blDataIteratorType,
 
 inline const blNumberType& blBinaryMatrixIterator<blDataIteratorType,blNumberType>::operator*()const
 {
-    return (*reinterpret_cast<blNumberType*>(m_iter));
+    return (*reinterpret_cast<const blNumberType*>(&(*m_iter)));
 }
 //-------------------------------------------------------------------
 
@@ -1121,9 +1314,9 @@ inline const blNumberType& blBinaryMatrixIterator<blDataIteratorType,blNumberTyp
 template<typename blDataIteratorType,
          typename blNumberType>
 
-inline blNumberType& blBinaryMatrixIterator<blDataIteratorType,blNumberType>::operator[](const std::ptrdiff_t& index)
+inline typename blBinaryMatrixIterator<blDataIteratorType,blNumberType>::reference blBinaryMatrixIterator<blDataIteratorType,blNumberType>::operator[](const std::ptrdiff_t& index)
 {
-    return (reinterpret_cast<blNumberType*>(m_beginIter)[index + 3]);
+    return (reinterpret_cast<pointer>(&(*m_beginIter))[index + 3]);
 }
 
 
@@ -1133,7 +1326,7 @@ template<typename blDataIteratorType,
 
 inline const blNumberType& blBinaryMatrixIterator<blDataIteratorType,blNumberType>::operator[](const std::ptrdiff_t& index)const
 {
-    return (reinterpret_cast<blNumberType*>(m_beginIter)[index + 3]);
+    return (reinterpret_cast<const blNumberType*>(&(*m_beginIter))[index + 3]);
 }
 
 
@@ -1141,9 +1334,9 @@ inline const blNumberType& blBinaryMatrixIterator<blDataIteratorType,blNumberTyp
 template<typename blDataIteratorType,
          typename blNumberType>
 
-inline blNumberType& blBinaryMatrixIterator<blDataIteratorType,blNumberType>::operator()(const std::ptrdiff_t& index)
+inline typename blBinaryMatrixIterator<blDataIteratorType,blNumberType>::reference blBinaryMatrixIterator<blDataIteratorType,blNumberType>::operator()(const std::ptrdiff_t& index)
 {
-    return (reinterpret_cast<blNumberType*>(m_beginIter)[index + 3]);
+    return (reinterpret_cast<pointer>(&(*m_beginIter))[index + 3]);
 }
 
 
@@ -1153,7 +1346,7 @@ template<typename blDataIteratorType,
 
 inline const blNumberType& blBinaryMatrixIterator<blDataIteratorType,blNumberType>::operator()(const std::ptrdiff_t& index)const
 {
-    return (reinterpret_cast<blNumberType*>(m_beginIter)[index + 3]);
+    return (reinterpret_cast<const blNumberType*>(&(*m_beginIter))[index + 3]);
 }
 
 
@@ -1161,9 +1354,9 @@ inline const blNumberType& blBinaryMatrixIterator<blDataIteratorType,blNumberTyp
 template<typename blDataIteratorType,
          typename blNumberType>
 
-inline blNumberType& blBinaryMatrixIterator<blDataIteratorType,blNumberType>::at(const std::ptrdiff_t& index)
+inline typename blBinaryMatrixIterator<blDataIteratorType,blNumberType>::reference blBinaryMatrixIterator<blDataIteratorType,blNumberType>::at(const std::ptrdiff_t& index)
 {
-    return (reinterpret_cast<blNumberType*>(m_beginIter)[index + 3]);
+    return (reinterpret_cast<pointer>(&(*m_beginIter))[index + 3]);
 }
 
 
@@ -1173,7 +1366,7 @@ template<typename blDataIteratorType,
 
 inline const blNumberType& blBinaryMatrixIterator<blDataIteratorType,blNumberType>::at(const std::ptrdiff_t& index)const
 {
-    return (reinterpret_cast<blNumberType*>(m_beginIter)[index + 3]);
+    return (reinterpret_cast<const blNumberType*>(&(*m_beginIter))[index + 3]);
 }
 
 
@@ -1181,8 +1374,8 @@ inline const blNumberType& blBinaryMatrixIterator<blDataIteratorType,blNumberTyp
 template<typename blDataIteratorType,
          typename blNumberType>
 
-inline blNumberType& blBinaryMatrixIterator<blDataIteratorType,blNumberType>::operator()(const std::ptrdiff_t& rowIndex,
-                                                                                         const std::ptrdiff_t& colIndex)
+inline typename blBinaryMatrixIterator<blDataIteratorType,blNumberType>::reference blBinaryMatrixIterator<blDataIteratorType,blNumberType>::operator()(const std::ptrdiff_t& rowIndex,
+                                                                                                                                                       const std::ptrdiff_t& colIndex)
 {
     return at(colIndex * m_rows + rowIndex);
 }
@@ -1203,8 +1396,8 @@ inline const blNumberType& blBinaryMatrixIterator<blDataIteratorType,blNumberTyp
 template<typename blDataIteratorType,
          typename blNumberType>
 
-inline blNumberType& blBinaryMatrixIterator<blDataIteratorType,blNumberType>::at(const std::ptrdiff_t& rowIndex,
-                                                                                 const std::ptrdiff_t& colIndex)
+inline typename blBinaryMatrixIterator<blDataIteratorType,blNumberType>::reference blBinaryMatrixIterator<blDataIteratorType,blNumberType>::at(const std::ptrdiff_t& rowIndex,
+                                                                                                                                               const std::ptrdiff_t& colIndex)
 {
     return at(colIndex * m_rows + rowIndex);
 }
@@ -1225,9 +1418,9 @@ inline const blNumberType& blBinaryMatrixIterator<blDataIteratorType,blNumberTyp
 template<typename blDataIteratorType,
          typename blNumberType>
 
-inline blNumberType& blBinaryMatrixIterator<blDataIteratorType,blNumberType>::operator()(const std::ptrdiff_t& rowIndex,
-                                                                                         const std::ptrdiff_t& colIndex,
-                                                                                         const std::ptrdiff_t& pageIndex)
+inline typename blBinaryMatrixIterator<blDataIteratorType,blNumberType>::reference blBinaryMatrixIterator<blDataIteratorType,blNumberType>::operator()(const std::ptrdiff_t& rowIndex,
+                                                                                                                                                       const std::ptrdiff_t& colIndex,
+                                                                                                                                                       const std::ptrdiff_t& pageIndex)
 {
     return at(pageIndex * m_rows * m_cols + colIndex * m_rows + rowIndex);
 }
@@ -1249,9 +1442,9 @@ inline const blNumberType& blBinaryMatrixIterator<blDataIteratorType,blNumberTyp
 template<typename blDataIteratorType,
          typename blNumberType>
 
-inline blNumberType& blBinaryMatrixIterator<blDataIteratorType,blNumberType>::at(const std::ptrdiff_t& rowIndex,
-                                                                                 const std::ptrdiff_t& colIndex,
-                                                                                 const std::ptrdiff_t& pageIndex)
+inline typename blBinaryMatrixIterator<blDataIteratorType,blNumberType>::reference blBinaryMatrixIterator<blDataIteratorType,blNumberType>::at(const std::ptrdiff_t& rowIndex,
+                                                                                                                                               const std::ptrdiff_t& colIndex,
+                                                                                                                                               const std::ptrdiff_t& pageIndex)
 {
     return at(pageIndex * m_rows * m_cols + colIndex * m_rows + rowIndex);
 }
@@ -0,0 +1,712 @@
+#ifndef BL_CSVBINARYCACHE_HPP
+#define BL_CSVBINARYCACHE_HPP
+
+
+
+//-------------------------------------------------------------------
+// FILE:            blCSVBinaryCache.hpp
+// CLASS:           blCSVBinaryCache
+// BASE CLASS:      None
+//
+//
+//
+// PURPOSE:         Class used to parse a csv file once and keep its
+//                  numbers in a binary sidecar file, so that later
+//                  opens of an unchanged csv file just map the binary
+//                  data instead of parsing the whole csv file again
+//
+//                  -- The sidecar file (by default the csv file path
+//                     followed by ".blbin") starts with a 64 bytes key
+//                     followed by the binary matrix, in the format read
+//                     by blBinaryMatrixIterator:
+//
+//                     -- Serial number, rows and cols
+//                     -- The data points in a column-major layout
+//
+//                  -- The key holds the size, modification time and a
+//                     content hash of the csv file, along with the row
+//                     and column tokens and the number type used, the
+//                     sidecar file is rebuilt whenever any of those
+//                     does not match
+//
+//                     -- The content hash only covers (at most) three
+//                        64KB blocks of the csv file (its beginning,
+//                        middle and end), so that checking whether the
+//                        sidecar file is fresh costs the same no matter
+//                        how big the csv file is
+//
+//                  -- The sidecar file is written to a temporary file
+//                     first and then renamed, so a reader never sees a
+//                     half written sidecar file
+//
+//                  -- The csv to binary transcoding is also available
+//                     on its own (writeCSVAsBinaryMatrix) for any csv
+//                     matrix iterator (with any number conversion policy)
+//                     and output stream, the data points are streamed to
+//                     the output, so the whole matrix is never held in
+//                     memory
+//
+//                  -- This class and its functions are defined within
+//                     the "blAlgorithmsLIB" namespace
+//
+//
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+//
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Includes needed for this file
+//-------------------------------------------------------------------
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <algorithm>
+#include <type_traits>
+
+#include "blEnumsAndConstants.hpp"
+#include "blStreamReadWrite.hpp"
+#include "blDataFingerprint.hpp"
+#include "blMappedFile.hpp"
+#include "blCSVMatrixIterator.hpp"
+#include "blBinaryMatrixIterator.hpp"
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// NOTE: This class is defined within the blAlgorithmsLIB namespace
+//-------------------------------------------------------------------
+namespace blAlgorithmsLIB
+{
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to write the numbers of csv data as a binary
+// matrix (serial number, rows, cols and then the data points
+// in a column-major layout), the format that is read by the
+// blBinaryMatrixIterator
+// The whole matrix is never held in memory, blocks of rows
+// are read in a row-major way and each of their columns is
+// written at its place in the column-major layout (or, when
+// the output stream can't seek, the data points are read in
+// a column-major way and written through a small buffer)
+// It returns the number of data points written
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType,
+         typename blOutputStreamType>
+
+inline std::size_t writeCSVAsBinaryMatrix(const blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>& csvMatrixIterator,
+                                          blOutputStreamType& outputStream,
+                                          const blNumberType& serialNumber = blNumberType(0))
+{
+    writeValue(outputStream,serialNumber);
+    writeValue(outputStream,static_cast<blNumberType>(csvMatrixIterator.rows()));
+    writeValue(outputStream,static_cast<blNumberType>(csvMatrixIterator.cols()));
+
+    std::size_t rows = static_cast<std::size_t>(csvMatrixIterator.rows());
+    std::size_t cols = static_cast<std::size_t>(csvMatrixIterator.cols());
+    std::size_t size = csvMatrixIterator.size();
+
+    if(size == 0)
+        return 0;
+
+    const std::size_t bufferLength = std::size_t(1) << 16;
+
+    std::size_t numberOfDataPointsWritten = 0;
+
+    auto matrixBeginPosition = outputStream.tellp();
+
+
+
+    // When the output stream can't seek,
+    // we read the data points in a column-
+    // major way (the row cursors of the
+    // iterator find each of them)
+
+    if(matrixBeginPosition == decltype(matrixBeginPosition)(-1))
+    {
+        auto colMajorIterator = csvMatrixIterator.begin();
+
+        colMajorIterator.setAdvancingIteratorMethod(COL_MAJOR);
+
+        std::vector<blNumberType> buffer(std::min(size,bufferLength));
+
+        while(numberOfDataPointsWritten < size)
+        {
+            std::size_t numberOfDataPointsRead = colMajorIterator.fill(buffer.begin(),
+                                                                       std::min(buffer.size(),size - numberOfDataPointsWritten));
+
+            if(numberOfDataPointsRead == 0)
+                break;
+
+            writeBuffer(outputStream,buffer,static_cast<int>(numberOfDataPointsRead));
+
+            numberOfDataPointsWritten += numberOfDataPointsRead;
+        }
+
+        return numberOfDataPointsWritten;
+    }
+
+
+
+    // Otherwise we first make room for the
+    // matrix, and then read blocks of rows in
+    // a row-major way, writing each column
+    // of a block at its place
+    // A file stream makes room by seeking to
+    // the last byte of the matrix and writing
+    // it, other streams (for ex. string streams)
+    // can't seek past their end, so we fill
+    // the matrix with zeros instead
+
+    std::size_t rowsPerBlock = std::max(std::size_t(1),bufferLength / cols);
+
+    std::vector<blNumberType> buffer(std::min(rowsPerBlock,rows) * cols,blNumberType(0));
+    std::vector<blNumberType> colBuffer(std::min(rowsPerBlock,rows));
+
+    const char lastByte = 0;
+
+    outputStream.seekp(matrixBeginPosition + static_cast<std::streamoff>(size * sizeof(blNumberType) - 1));
+    outputStream.write(&lastByte,1);
+
+    if(!outputStream)
+    {
+        outputStream.clear();
+        outputStream.seekp(matrixBeginPosition);
+
+        for(std::size_t i = 0; i < size; i += buffer.size())
+            writeBuffer(outputStream,buffer,static_cast<int>(std::min(buffer.size(),size - i)));
+    }
+
+    auto rowMajorIterator = csvMatrixIterator.begin();
+
+    rowMajorIterator.setAdvancingIteratorMethod(ROW_MAJOR);
+
+    for(std::size_t firstRowIndex = 0; firstRowIndex < rows && outputStream; firstRowIndex += rowsPerBlock)
+    {
+        std::size_t numberOfRows = std::min(rowsPerBlock,rows - firstRowIndex);
+
+        std::size_t numberOfDataPointsRead = rowMajorIterator.fill(buffer.begin(),numberOfRows * cols);
+
+        numberOfRows = numberOfDataPointsRead / cols;
+
+        for(std::size_t colIndex = 0; colIndex < cols; ++colIndex)
+        {
+            for(std::size_t i = 0; i < numberOfRows; ++i)
+                colBuffer[i] = buffer[i * cols + colIndex];
+
+            outputStream.seekp(matrixBeginPosition + static_cast<std::streamoff>((colIndex * rows + firstRowIndex) * sizeof(blNumberType)));
+
+            writeBuffer(outputStream,colBuffer,static_cast<int>(numberOfRows));
+        }
+
+        numberOfDataPointsWritten += numberOfRows * cols;
+
+        if(numberOfRows < std::min(rowsPerBlock,rows - firstRowIndex))
+            break;
+    }
+
+    outputStream.seekp(matrixBeginPosition + static_cast<std::streamoff>(size * sizeof(blNumberType)));
+
+    return numberOfDataPointsWritten;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+template<typename blNumberType>
+
+class blCSVBinaryCache
+{
+public: // Constructors and destructor
+
+
+
+    // Default constructor
+
+    blCSVBinaryCache();
+
+
+
+    // A cache can be moved but
+    // not copied
+
+    blCSVBinaryCache(const blCSVBinaryCache<blNumberType>& csvBinaryCache) = delete;
+
+    blCSVBinaryCache(blCSVBinaryCache<blNumberType>&& csvBinaryCache) = default;
+
+
+
+public: // Assignment operators
+
+
+
+    blCSVBinaryCache<blNumberType>&                                     operator=(const blCSVBinaryCache<blNumberType>& csvBinaryCache) = delete;
+
+    blCSVBinaryCache<blNumberType>&                                     operator=(blCSVBinaryCache<blNumberType>&& csvBinaryCache) = default;
+
+
+
+public: // Public functions
+
+
+
+    // Function used to open the binary
+    // sidecar file of a csv file, which is
+    // first (re)built if it is missing or
+    // stale
+    // An empty sidecar file path means
+    // using the csv file path followed
+    // by ".blbin"
+    // It returns false if the csv file
+    // could not be read or the sidecar
+    // file could not be written/mapped
+
+    bool                                                                open(const std::string& csvFilePath,
+                                                                             const std::string& rowTokens = ";\r\n",
+                                                                             const std::string& colTokens = " ,",
+                                                                             const std::string& cacheFilePath = std::string());
+
+    void                                                                close();
+
+
+
+    // Function used to check whether the
+    // sidecar file of a csv file exists and
+    // matches the csv file and tokens
+
+    static bool                                                         isCacheFresh(const std::string& csvFilePath,
+                                                                                     const std::string& rowTokens = ";\r\n",
+                                                                                     const std::string& colTokens = " ,",
+                                                                                     const std::string& cacheFilePath = std::string());
+
+
+
+    // Functions used to get the state
+    // of the cache, whether the last
+    // open had to (re)build the sidecar
+    // file and the sidecar file path
+
+    bool                                                                isOpen()const;
+    const bool&                                                         wasCacheRebuilt()const;
+    const std::string&                                                  getCacheFilePath()const;
+
+
+
+    // Functions used to get the mapped
+    // binary matrix (without the key)
+    // and an iterator over it
+
+    const char*                                                         begin()const;
+    const char*                                                         end()const;
+
+    blBinaryMatrixIterator<const char*,blNumberType>                    getMatrixIterator(const blAdvancingIteratorMethod& advancingIteratorMethod = COL_MAJOR)const;
+
+
+
+private: // Static functions/variables/constants
+
+
+
+    // Size in bytes of the key written
+    // at the beginning of the sidecar file
+    // (a multiple of 64, so that the
+    // numbers stay aligned)
+
+    static const std::size_t                                            s_keySize = 64;
+
+
+
+    // Size in bytes of each block of
+    // the csv file hashed for the key
+
+    static const std::size_t                                            s_hashedBlockSize = 1 << 16;
+
+
+
+protected: // Protected functions
+
+
+
+    // Function used to build the key
+    // of a csv file (it returns false if
+    // the csv file can't be read)
+
+    static bool                                                         buildKey(const std::string& csvFilePath,
+                                                                                 const std::string& rowTokens,
+                                                                                 const std::string& colTokens,
+                                                                                 std::vector<std::uint64_t>& key);
+
+
+
+    // Function used to read the key
+    // of a sidecar file
+
+    static bool                                                         readKey(const std::string& cacheFilePath,
+                                                                                std::vector<std::uint64_t>& key);
+
+
+
+    // Function used to parse the csv
+    // file and write the sidecar file
+
+    static bool                                                         buildCache(const std::string& csvFilePath,
+                                                                                   const std::string& rowTokens,
+                                                                                   const std::string& colTokens,
+                                                                                   const std::string& cacheFilePath,
+                                                                                   const std::vector<std::uint64_t>& key);
+
+
+
+protected: // Protected variables
+
+
+
+    // The mapped sidecar file
+
+    blMappedFile                                                        m_cacheFile;
+
+
+
+    // Path of the sidecar file
+
+    std::string                                                         m_cacheFilePath;
+
+
+
+    // Flag telling us whether
+    // the last open had to
+    // (re)build the sidecar file
+
+    bool                                                                m_wasCacheRebuilt;
+};
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+template<typename blNumberType>
+
+inline blCSVBinaryCache<blNumberType>::blCSVBinaryCache()
+{
+    m_wasCacheRebuilt = false;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+template<typename blNumberType>
+
+inline bool blCSVBinaryCache<blNumberType>::open(const std::string& csvFilePath,
+                                                 const std::string& rowTokens,
+                                                 const std::string& colTokens,
+                                                 const std::string& cacheFilePath)
+{
+    close();
+
+    m_cacheFilePath = cacheFilePath.empty() ? csvFilePath + ".blbin" : cacheFilePath;
+
+
+
+    std::vector<std::uint64_t> csvKey;
+
+    if(!buildKey(csvFilePath,rowTokens,colTokens,csvKey))
+        return false;
+
+    std::vector<std::uint64_t> cacheKey;
+
+    if(!readKey(m_cacheFilePath,cacheKey) || cacheKey != csvKey)
+    {
+        if(!buildCache(csvFilePath,rowTokens,colTokens,m_cacheFilePath,csvKey))
+            return false;
+
+        m_wasCacheRebuilt = true;
+    }
+
+
+
+    if(!m_cacheFile.open(m_cacheFilePath,RANDOM_ACCESS) ||
+       m_cacheFile.size() < s_keySize)
+    {
+        close();
+        return false;
+    }
+
+    return true;
+}
+
+
+
+template<typename blNumberType>
+
+inline void blCSVBinaryCache<blNumberType>::close()
+{
+    m_cacheFile.close();
+    m_wasCacheRebuilt = false;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+template<typename blNumberType>
+
+inline bool blCSVBinaryCache<blNumberType>::isCacheFresh(const std::string& csvFilePath,
+                                                         const std::string& rowTokens,
+                                                         const std::string& colTokens,
+                                                         const std::string& cacheFilePath)
+{
+    std::vector<std::uint64_t> csvKey;
+    std::vector<std::uint64_t> cacheKey;
+
+    return (buildKey(csvFilePath,rowTokens,colTokens,csvKey) &&
+            readKey(cacheFilePath.empty() ? csvFilePath + ".blbin" : cacheFilePath,cacheKey) &&
+            cacheKey == csvKey);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+template<typename blNumberType>
+
+inline bool blCSVBinaryCache<blNumberType>::isOpen()const
+{
+    return m_cacheFile.isOpen();
+}
+
+
+
+template<typename blNumberType>
+
+inline const bool& blCSVBinaryCache<blNumberType>::wasCacheRebuilt()const
+{
+    return m_wasCacheRebuilt;
+}
+
+
+
+template<typename blNumberType>
+
+inline const std::string& blCSVBinaryCache<blNumberType>::getCacheFilePath()const
+{
+    return m_cacheFilePath;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+template<typename blNumberType>
+
+inline const char* blCSVBinaryCache<blNumberType>::begin()const
+{
+    if(m_cacheFile.size() < s_keySize)
+        return m_cacheFile.end();
+
+    return m_cacheFile.begin() + s_keySize;
+}
+
+
+
+template<typename blNumberType>
+
+inline const char* blCSVBinaryCache<blNumberType>::end()const
+{
+    return m_cacheFile.end();
+}
+
+
+
+template<typename blNumberType>
+
+inline blBinaryMatrixIterator<const char*,blNumberType> blCSVBinaryCache<blNumberType>::getMatrixIterator(const blAdvancingIteratorMethod& advancingIteratorMethod)const
+{
+    return blBinaryMatrixIterator<const char*,blNumberType>(begin(),end(),advancingIteratorMethod);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to build the key of a csv file, made of:
+//
+// -- A tag ("BLCSVBIN")
+// -- The size and signedness/type of the numbers
+// -- The size of the csv file
+// -- The modification time of the csv file
+// -- The hash of the beginning, middle and end of the csv file
+// -- The hash of the row and column tokens
+//-------------------------------------------------------------------
+template<typename blNumberType>
+
+inline bool blCSVBinaryCache<blNumberType>::buildKey(const std::string& csvFilePath,
+                                                     const std::string& rowTokens,
+                                                     const std::string& colTokens,
+                                                     std::vector<std::uint64_t>& key)
+{
+    std::uint64_t fileSize = 0;
+    std::uint64_t fileModificationTime = 0;
+
+    if(!getFileSizeAndModificationTime(csvFilePath,fileSize,fileModificationTime))
+        return false;
+
+
+
+    // We hash (at most) three blocks
+    // of the csv file
+
+    std::ifstream csvFile(csvFilePath,std::ios::binary);
+
+    if(!csvFile)
+        return false;
+
+    std::uint64_t contentHash = BL_INITIAL_HASH;
+
+    std::vector<char> block(s_hashedBlockSize);
+
+    std::uint64_t blockOffsets[3] = {0,
+                                     fileSize / 2,
+                                     (fileSize > s_hashedBlockSize) ? fileSize - s_hashedBlockSize : 0};
+
+    for(const auto& blockOffset : blockOffsets)
+    {
+        csvFile.clear();
+        csvFile.seekg(static_cast<std::streamoff>(blockOffset));
+        csvFile.read(block.data(),static_cast<std::streamsize>(block.size()));
+
+        hashBytes(block.data(),block.data() + csvFile.gcount(),contentHash);
+    }
+
+
+
+    std::uint64_t tokensHash = BL_INITIAL_HASH;
+
+    std::string tokens = rowTokens + '\0' + colTokens;
+
+    hashBytes(tokens.begin(),tokens.end(),tokensHash);
+
+
+
+    std::uint64_t tag = 0;
+    std::memcpy(&tag,"BLCSVBIN",sizeof(tag));
+
+    std::uint64_t numberType = static_cast<std::uint64_t>(sizeof(blNumberType)) |
+                               (std::is_floating_point<blNumberType>::value ? 0x100u : 0u) |
+                               (std::is_signed<blNumberType>::value ? 0x200u : 0u);
+
+    key.assign(s_keySize / sizeof(std::uint64_t),0);
+
+    key[0] = tag;
+    key[1] = numberType;
+    key[2] = fileSize;
+    key[3] = fileModificationTime;
+    key[4] = contentHash;
+    key[5] = tokensHash;
+
+    return true;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+template<typename blNumberType>
+
+inline bool blCSVBinaryCache<blNumberType>::readKey(const std::string& cacheFilePath,
+                                                    std::vector<std::uint64_t>& key)
+{
+    std::ifstream cacheFile(cacheFilePath,std::ios::binary);
+
+    if(!cacheFile)
+        return false;
+
+    key.assign(s_keySize / sizeof(std::uint64_t),0);
+
+    readBuffer(cacheFile,key);
+
+    return (cacheFile.gcount() == static_cast<std::streamsize>(s_keySize));
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+template<typename blNumberType>
+
+inline bool blCSVBinaryCache<blNumberType>::buildCache(const std::string& csvFilePath,
+                                                       const std::string& rowTokens,
+                                                       const std::string& colTokens,
+                                                       const std::string& cacheFilePath,
+                                                       const std::vector<std::uint64_t>& key)
+{
+    blMappedFile csvFile;
+
+    if(!csvFile.open(csvFilePath,SEQUENTIAL_ACCESS))
+        return false;
+
+    blCSVMatrixIterator<const char*,blNumberType> csvMatrixIterator(csvFile.begin(),
+                                                                     csvFile.end(),
+                                                                     rowTokens,
+                                                                     colTokens);
+
+
+
+    // We write to a temporary file
+    // and then rename it, so that the
+    // sidecar file is never seen half
+    // written
+
+    std::string temporaryFilePath = cacheFilePath + ".tmp";
+
+    {
+        std::ofstream cacheFile(temporaryFilePath,std::ios::binary | std::ios::trunc);
+
+        if(!cacheFile)
+            return false;
+
+        writeBuffer(cacheFile,key);
+
+        writeCSVAsBinaryMatrix(csvMatrixIterator,cacheFile);
+
+        if(!cacheFile)
+        {
+            cacheFile.close();
+            std::remove(temporaryFilePath.c_str());
+            return false;
+        }
+    }
+
+    return replaceFileWithTemporaryFile(cacheFilePath,temporaryFilePath);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// End of namespace
+}
+//-------------------------------------------------------------------
+
+
+
+#endif // BL_CSVBINARYCACHE_HPP
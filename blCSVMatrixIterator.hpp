@@ -28,6 +28,112 @@
 //                        next to each other it does not count that as a Row
 //                        or as a column, it just skips over it
 //
+//                  -- The iterator can optionally build a row index (the
+//                     offset of the beginning of each data row) while it
+//                     counts the rows, so that random access only needs to
+//                     scan the one row being accessed instead of the whole
+//                     csv data up to that point
+//
+//                  -- The iterator can also optionally record the offset of
+//                     every Kth data point (sparse checkpoints), so that a
+//                     move never scans more than K data points while the
+//                     memory used stays bounded to (rows * cols) / K offsets
+//
+//                  -- When advancing in a column-major way, the iterator keeps
+//                     a cursor for each row (pointing to the last visited data
+//                     point of that row), so that traversing the whole csv data
+//                     column by column costs time linear in the size of the data
+//
+//                  -- The whole numeric body of the csv data can also be parsed
+//                     in one forward pass straight into a contiguous buffer
+//                     (materialize), in either a row-major or column-major layout
+//
+//                  -- For big csv data the materialization can be split across
+//                     multiple threads, each parsing a chunk of whole rows
+//
+//                  -- Quoted fields (RFC 4180) are supported, tokens inside
+//                     quotes are not counted as row or column tokens, quoted
+//                     numbers have their column tokens (for ex. the thousands
+//                     separator in "1,234.5") dropped, and quoted column names
+//                     are unquoted
+//
+//                     -- The csv data is checked for quotes once, when counting
+//                        its rows and columns, data without any quotes keeps
+//                        using the faster quote-unaware scanning
+//
+//                  -- The user can select (project) a subset of the columns,
+//                     by name or by index, in which case the iterator exposes
+//                     a narrower matrix made only of those columns, and the
+//                     unselected fields are skipped over without being
+//                     converted to numbers
+//
+//                  -- The csv data can also be parsed into typed columns, with
+//                     the type of each column (int32, int64, float, double or
+//                     categorical string) either provided or inferred from a
+//                     sample of the first rows, so that each column is stored
+//                     in its natural width and parsed with a converter suited
+//                     to its type
+//
+//                  -- The statistics of every column (count, NaN count, min,
+//                     max, mean, variance and an estimate of the number of
+//                     distinct values) can be computed in one scan of the csv
+//                     data, split across multiple threads whose partial
+//                     statistics are then merged
+//
+//                  -- The layout of the csv data (tokens, dimensions, column
+//                     names, row index and checkpoints) is shared between
+//                     copies of the iterator, so copying it (begin, end, +, -,
+//                     postfix ++) never allocates
+//
+//                  -- Csv data that is still being appended to (for ex. a log
+//                     file) can be followed incrementally, only the new bytes
+//                     (and the last row, which might have been partial) are
+//                     scanned to update the rows, row index and checkpoints
+//
+//                  -- The data rows can be filtered while scanning the csv
+//                     data, only the fields of the key columns are converted
+//                     to decide whether a row is selected, and only the
+//                     selected rows are then parsed into a filtered matrix
+//
+//                  -- Data rows with different numbers of fields (ragged
+//                     rows) can optionally be handled, the number of fields
+//                     of each row is recorded while counting the rows and the
+//                     data points missing from shorter rows take a missing
+//                     value (NaN by default)
+//
+//                  -- The layout can be saved to an index file (for ex. a
+//                     ".blidx" file) together with a fingerprint of the csv
+//                     data, so that the next time the same csv data is opened
+//                     the layout is loaded instead of scanning the csv data
+//                     (the fingerprint hashes every byte of the csv data, so
+//                     any change to it invalidates the index)
+//
+//                  -- The text of each field is converted into a number by
+//                     a conversion policy, a template parameter that defaults
+//                     to blDefaultNumberConverter, so the conversion done on
+//                     every move of the iterator is resolved at compile time
+//                     and can be inlined (a custom policy can for ex. parse
+//                     numbers with a decimal comma)
+//
+//                  -- The next N data points (in the advancing order) can be
+//                     read in one call, when advancing in a row-major way the
+//                     fields are converted in one forward pass (whole rows are
+//                     parsed from the row index when columns are projected or
+//                     rows are ragged) and the iterator is only moved once
+//
+//                  -- A data row can be handed out as a blCSVRowView, which
+//                     holds the byte range of the row and the offsets of its
+//                     fields and converts them only when they are accessed,
+//                     so reading a whole row does not move the iterator
+//                     (the view shares the iterator's layout, so it can
+//                     outlive the iterator but not the csv data)
+//
+//                  -- Comment lines (lines beginning with one of the user's
+//                     comment prefixes, for ex. "#") and a given number of
+//                     header rows before the first data row are skipped
+//                     while counting the rows and columns, so metadata at
+//                     the top of a file doesn't need a separate pass
+//
 //                  -- This class and its functions are defined within
 //                     the "blAlgorithmsLIB" namespace
 //
@@ -55,10 +161,26 @@
 #include <iostream>
 #include <atomic>
 #include <sstream>
+#include <algorithm>
+#include <utility>
+#include <thread>
+#include <mutex>
+#include <memory>
+#include <limits>
+#include <fstream>
+#include <cstdio>
+#include <cstdint>
 
 #include "blEnumsAndConstants.hpp"
 #include "blConvertToNumber.hpp"
 #include "blCountAndFind.hpp"
+#include "blStreamReadWrite.hpp"
+#include "blDataFingerprint.hpp"
+#include "blSIMDTokenScanner.hpp"
+#include "blCSVMatrixLayout.hpp"
+#include "blCSVTypedColumn.hpp"
+#include "blColumnStatistics.hpp"
+#include "blCSVRowView.hpp"
 //-------------------------------------------------------------------
 
 
@@ -74,10 +196,22 @@ namespace blAlgorithmsLIB
 
 //-------------------------------------------------------------------
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType = blDefaultNumberConverter>
 
 class blCSVMatrixIterator
 {
+public: // Friend classes
+
+
+
+    // The row views unquote their
+    // fields like this iterator does
+
+    friend class blCSVRowView<blDataIteratorType,blNumberType,blNumberConverterType>;
+
+
+
 public: // Iterator traits
 
 
@@ -102,18 +236,46 @@ public: // Constructors and destructor
 
     // Constructor from two iterators
     // and row and column tokens
+    // When an index file is specified, the
+    // layout of the csv data is loaded from
+    // it if it matches the csv data, otherwise
+    // the csv data is scanned (building the
+    // row index) and the index file is
+    // (re)written (see saveIndex)
+    // The ragged rows mode, the comment
+    // prefixes and the number of header rows
+    // are applied before the csv data is
+    // scanned, so the number of fields of
+    // each row is recorded and the comment
+    // lines and header rows are skipped in
+    // the same scan (and they are part of
+    // the index file)
 
     blCSVMatrixIterator(const blDataIteratorType& beginIter,
                         const blDataIteratorType& endIter,
                         const std::string rowTokens = ";\r\n",
                         const std::string colTokens = " ,",
-                        const blAdvancingIteratorMethod& advancingIteratorMethod = blAlgorithmsLIB::ROW_MAJOR);
+                        const blAdvancingIteratorMethod& advancingIteratorMethod = blAlgorithmsLIB::ROW_MAJOR,
+                        const bool& shouldRowIndexBeBuilt = false,
+                        const std::ptrdiff_t& dataPointCheckpointInterval = 0,
+                        const std::string& indexFilePath = std::string(),
+                        const bool& shouldRaggedRowsBeHandled = false,
+                        const std::vector<std::string>& commentPrefixes = std::vector<std::string>(),
+                        const std::ptrdiff_t& numberOfHeaderRows = -1);
+
+
 
+    // Copy constructor, the copy shares
+    // the layout but not the row cursors
+    // (see moveIteratorUsingRowCursors)
 
+    blCSVMatrixIterator(const blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>& csvMatrixIterator);
 
-    // Default copy constructor
 
-    blCSVMatrixIterator(const blCSVMatrixIterator<blDataIteratorType,blNumberType>& csvMatrixIterator) = default;
+
+    // Default move constructor
+
+    blCSVMatrixIterator(blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>&& csvMatrixIterator) = default;
 
 
 
@@ -127,9 +289,17 @@ public: // Assignment operators
 
 
 
-    // Default assignment operator
+    // Assignment operator, like the copy
+    // constructor it doesn't copy the
+    // row cursors
+
+    blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>&         operator=(const blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>& csvMatrixIterator);
+
 
-    blCSVMatrixIterator<blDataIteratorType,blNumberType>&               operator=(const blCSVMatrixIterator<blDataIteratorType,blNumberType>& csvMatrixIterator) = default;
+
+    // Default move assignment operator
+
+    blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>&         operator=(blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>&& csvMatrixIterator) = default;
 
 
 
@@ -150,8 +320,8 @@ public: // Comparison operators
 
 
 
-    bool                                                                operator==(const blCSVMatrixIterator<blDataIteratorType,blNumberType>& csvMatrixIterator)const;
-    bool                                                                operator!=(const blCSVMatrixIterator<blDataIteratorType,blNumberType>& csvMatrixIterator)const;
+    bool                                                                operator==(const blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>& csvMatrixIterator)const;
+    bool                                                                operator!=(const blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>& csvMatrixIterator)const;
 
 
 
@@ -186,14 +356,14 @@ public: // Arithmetic operators
 
 
 
-    blCSVMatrixIterator<blDataIteratorType,blNumberType>&               operator+=(const std::ptrdiff_t& movement);
-    blCSVMatrixIterator<blDataIteratorType,blNumberType>&               operator-=(const std::ptrdiff_t& movement);
-    blCSVMatrixIterator<blDataIteratorType,blNumberType>&               operator++();
-    blCSVMatrixIterator<blDataIteratorType,blNumberType>&               operator--();
-    blCSVMatrixIterator<blDataIteratorType,blNumberType>                operator++(int);
-    blCSVMatrixIterator<blDataIteratorType,blNumberType>                operator--(int);
-    blCSVMatrixIterator<blDataIteratorType,blNumberType>                operator+(const std::ptrdiff_t& movement)const;
-    blCSVMatrixIterator<blDataIteratorType,blNumberType>                operator-(const std::ptrdiff_t& movement)const;
+    blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>&         operator+=(const std::ptrdiff_t& movement);
+    blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>&         operator-=(const std::ptrdiff_t& movement);
+    blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>&         operator++();
+    blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>&         operator--();
+    blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>          operator++(int);
+    blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>          operator--(int);
+    blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>          operator+(const std::ptrdiff_t& movement)const;
+    blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>          operator-(const std::ptrdiff_t& movement)const;
 
 
 
@@ -201,7 +371,7 @@ public: // Arithmetic operators
     // two pointers (it gives the
     // distance)
 
-    std::ptrdiff_t                                                      operator-(const blCSVMatrixIterator<blDataIteratorType,blNumberType>& csvMatrixIterator)const;
+    std::ptrdiff_t                                                      operator-(const blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>& csvMatrixIterator)const;
 
 
 
@@ -223,6 +393,10 @@ public: // Public functions
     // Functions used to manually
     // set the data iterators and
     // the Row and Column Token
+    // The last one also sets the ragged
+    // rows mode, the comment prefixes and
+    // the number of header rows, before
+    // the csv data is scanned
 
     void                                                                setRowTokens(const std::string& rowTokens);
 
@@ -239,6 +413,21 @@ public: // Public functions
                                                                                      const std::string& rowTokens,
                                                                                      const std::string& colTokens);
 
+    void                                                                setIterators(const blDataIteratorType& beginIter,
+                                                                                     const blDataIteratorType& endIter,
+                                                                                     const std::string& rowTokens,
+                                                                                     const std::string& colTokens,
+                                                                                     const std::string& indexFilePath);
+
+    void                                                                setIterators(const blDataIteratorType& beginIter,
+                                                                                     const blDataIteratorType& endIter,
+                                                                                     const std::string& rowTokens,
+                                                                                     const std::string& colTokens,
+                                                                                     const std::string& indexFilePath,
+                                                                                     const bool& shouldRaggedRowsBeHandled,
+                                                                                     const std::vector<std::string>& commentPrefixes = std::vector<std::string>(),
+                                                                                     const std::ptrdiff_t& numberOfHeaderRows = -1);
+
 
 
     // Function used to calculate the total
@@ -249,6 +438,53 @@ public: // Public functions
 
 
 
+    // Function used to know whether a
+    // row begins with a comment prefix
+
+    bool                                                                isCommentRow(const blDataIteratorType& rowBeginIter)const;
+
+
+
+    // Functions used to follow csv data that
+    // is still being appended to
+    // Only the newly appended data (and the
+    // last row, since it might have been
+    // partial) is scanned
+    // The second version is used when the
+    // data has been moved to a new (extended)
+    // buffer, which must start with the same
+    // data that was already scanned
+
+    void                                                                appendData(const blDataIteratorType& newEndIter);
+
+    void                                                                appendData(const blDataIteratorType& newBeginIter,
+                                                                                   const blDataIteratorType& newEndIter);
+
+
+
+    // Functions used to save the layout of
+    // the csv data (dimensions, column names,
+    // row index and data point checkpoints) to
+    // an index (for ex. a ".blidx" file) and to
+    // load it back instead of scanning the
+    // csv data
+    // The index also holds the row/column
+    // tokens and the length and fingerprint
+    // of the csv data, loading fails (returning
+    // false and leaving the iterator unchanged)
+    // when they don't match
+    // NOTE:  The column projection is not
+    //        saved, the current one is applied
+    //        to the loaded layout
+
+    bool                                                                saveIndex(std::ostream& outputStream)const;
+    bool                                                                saveIndex(const std::string& indexFilePath)const;
+
+    bool                                                                loadIndex(std::istream& inputStream);
+    bool                                                                loadIndex(const std::string& indexFilePath);
+
+
+
     // Functions used to get this class' members
 
     const blDataIteratorType&                                           getBeginIter()const;
@@ -270,6 +506,124 @@ public: // Public functions
     const std::string&                                                  colTokens()const;
 
     const std::vector<std::string>&                                     getColumnNames()const;
+    const std::vector<std::string>&                                     getColumnNamesInData()const;
+
+    const bool&                                                         hasQuotedFields()const;
+
+
+
+    // Functions used to enable/disable
+    // the row index, when enabled the
+    // offset of the beginning of each
+    // data row is recorded while counting
+    // the rows, making random access
+    // proportional to the length of one
+    // row instead of the size of the data
+
+    void                                                                setShouldRowIndexBeBuilt(const bool& shouldRowIndexBeBuilt);
+    const bool&                                                         getShouldRowIndexBeBuilt()const;
+    bool                                                                isRowIndexBuilt()const;
+    const std::vector<std::ptrdiff_t>&                                  getRowOffsets()const;
+
+
+
+    // Functions used to enable/disable the
+    // ragged rows mode, in which data rows
+    // can have different numbers of fields
+    // The number of fields of each row is
+    // recorded while counting the rows, the
+    // number of columns is the one of the
+    // longest row and the data points missing
+    // from shorter rows take the missing value
+    // (NaN by default)
+    // The mode needs the row index (which is
+    // built and can't be disabled while in
+    // this mode), so that moving to any data
+    // point only scans (part of) its row
+    // Changing the mode scans the csv data
+    // again, so it's best enabled when
+    // constructing the iterator (or in
+    // setIterators)
+    // NOTE:  Typed columns hold zeros for the
+    //        missing data points, and column
+    //        statistics count them as NaNs
+
+    void                                                                setShouldRaggedRowsBeHandled(const bool& shouldRaggedRowsBeHandled);
+    const bool&                                                         getShouldRaggedRowsBeHandled()const;
+    bool                                                                areRowFieldCountsBuilt()const;
+    const std::vector<std::ptrdiff_t>&                                  getRowFieldCounts()const;
+
+    void                                                                setMissingValue(const blNumberType& missingValue);
+    const blNumberType&                                                 getMissingValue()const;
+    bool                                                                isCurrentDataPointMissing()const;
+
+
+
+    // Functions used to set/get the policy
+    // used to convert the fields into numbers
+    // (setting it converts the current data
+    // point again)
+
+    void                                                                setNumberConverter(const blNumberConverterType& numberConverter);
+    const blNumberConverterType&                                        getNumberConverter()const;
+
+
+
+    // Functions used to set/get the
+    // interval K between recorded data
+    // point checkpoints (the offset of
+    // every Kth data point is recorded)
+    // An interval of zero disables the
+    // checkpoints
+
+    void                                                                setDataPointCheckpointInterval(const std::ptrdiff_t& dataPointCheckpointInterval);
+    const std::ptrdiff_t&                                               getDataPointCheckpointInterval()const;
+    bool                                                                areDataPointCheckpointsBuilt()const;
+    const std::vector<std::ptrdiff_t>&                                  getDataPointCheckpointOffsets()const;
+
+
+
+    // Functions used to set/get the prefixes
+    // of the comment lines and the number
+    // of header rows before the data rows
+    // Comment lines (and empty lines) found
+    // before the first data row are skipped,
+    // and the column names are taken from
+    // the first header row
+    // A number of header rows of -1 (the
+    // default) means that the first row is
+    // a title row only when it contains
+    // non-numeric characters
+    // Changing them scans the csv data again,
+    // so they're best given when constructing
+    // the iterator (or in setIterators)
+    // NOTE:  Comment lines after the first
+    //        data row are read as data rows
+
+    void                                                                setCommentPrefixes(const std::vector<std::string>& commentPrefixes);
+    const std::vector<std::string>&                                     getCommentPrefixes()const;
+
+    void                                                                setNumberOfHeaderRows(const std::ptrdiff_t& numberOfHeaderRows);
+    const std::ptrdiff_t&                                               getNumberOfHeaderRows()const;
+
+
+
+    // Functions used to select (project)
+    // the columns exposed by the iterator,
+    // either by their index in the csv data
+    // or by their name (as found in the
+    // title row), in the order given
+    // Unknown names and indexes and repeated
+    // columns are ignored, and an empty
+    // selection means all the columns
+    // The iterator is moved to the beginning
+
+    void                                                                setColumnProjection(const std::vector<std::ptrdiff_t>& colIndexesInData);
+    void                                                                setColumnProjection(const std::vector<std::string>& colNames);
+    void                                                                clearColumnProjection();
+    bool                                                                isColumnProjected()const;
+    const std::vector<std::ptrdiff_t>&                                  getColumnProjection()const;
+    const std::ptrdiff_t&                                               colsInData()const;
 
 
 
@@ -285,8 +639,8 @@ public: // Public functions
     // iterator position to the beginning
     // or to the end
 
-    blCSVMatrixIterator<blDataIteratorType,blNumberType>&               moveToTheBeginning();
-    blCSVMatrixIterator<blDataIteratorType,blNumberType>&               moveToTheEnd();
+    blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>&         moveToTheBeginning();
+    blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>&         moveToTheEnd();
 
 
 
@@ -295,11 +649,198 @@ public: // Public functions
     // this can be used in stl
     // algorithms
 
-    blCSVMatrixIterator<blDataIteratorType,blNumberType>                begin()const;
-    blCSVMatrixIterator<blDataIteratorType,blNumberType>                end()const;
+    blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>          begin()const;
+    blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>          end()const;
+
+    blCSVMatrixIterator<const blDataIteratorType,blNumberType,blNumberConverterType>    cbegin()const;
+    blCSVMatrixIterator<const blDataIteratorType,blNumberType,blNumberConverterType>    cend()const;
 
-    blCSVMatrixIterator<const blDataIteratorType,blNumberType>          cbegin()const;
-    blCSVMatrixIterator<const blDataIteratorType,blNumberType>          cend()const;
+
+
+    // Function used to read the next data
+    // points (starting with the current one)
+    // in the advancing order into the output
+    // iterator and to move the iterator past
+    // them
+    // It stops at the end of the data and
+    // returns the number of data points read
+
+    template<typename blOutputIteratorType>
+    std::size_t                                                         fill(blOutputIteratorType outputIter,
+                                                                             const std::size_t& numberOfValues);
+
+
+
+    // Functions used to parse the whole
+    // numeric body of the csv data in one
+    // forward pass and write it into a
+    // contiguous buffer, either a caller
+    // provided one (random access iterator
+    // pointing to at least size() elements)
+    // or a vector that gets resized to fit
+    // The functions return the number of
+    // data points written
+
+    template<typename blOutputIteratorType>
+    std::size_t                                                         materialize(blOutputIteratorType outputIter,
+                                                                                    const blAdvancingIteratorMethod& outputLayout = ROW_MAJOR)const;
+
+    template<typename blAllocatorType>
+    std::size_t                                                         materialize(std::vector<blNumberType,blAllocatorType>& matrix,
+                                                                                    const blAdvancingIteratorMethod& outputLayout = ROW_MAJOR)const;
+
+
+
+    // Same as the above functions, but the
+    // csv data is split into chunks of whole
+    // rows that are parsed concurrently
+    // A number of threads equal to zero means
+    // using as many threads as the hardware
+    // supports
+    //
+    // NOTE:  These functions assume that every
+    //        data row has exactly cols() data
+    //        points, unless in the ragged rows
+    //        mode
+
+    template<typename blOutputIteratorType>
+    std::size_t                                                         materializeInParallel(blOutputIteratorType outputIter,
+                                                                                              const blAdvancingIteratorMethod& outputLayout = ROW_MAJOR,
+                                                                                              const std::size_t& numberOfThreads = 0)const;
+
+    template<typename blAllocatorType>
+    std::size_t                                                         materializeInParallel(std::vector<blNumberType,blAllocatorType>& matrix,
+                                                                                              const blAdvancingIteratorMethod& outputLayout = ROW_MAJOR,
+                                                                                              const std::size_t& numberOfThreads = 0)const;
+
+
+
+    // Function used to infer the type of
+    // each (projected) column from a sample
+    // of the first data rows
+    // NOTE:  The rest of the csv data is not
+    //        looked at, so materializeColumns
+    //        widens a column whose field does
+    //        not fit the inferred type (for ex.
+    //        3.7 or 99999999999 in a 32 bits
+    //        integer column), INT32 to INT64 to
+    //        DOUBLE and FLOAT to DOUBLE, and
+    //        a field that is not a number at
+    //        all is stored as zero and its row
+    //        is recorded in the column (see
+    //        blCSVTypedColumn::getUnparsableRowIndexes),
+    //        an empty field is stored as zero
+
+    std::vector<blColumnType>                                           inferColumnTypes(const std::ptrdiff_t& numberOfRowsToSample = 100)const;
+
+
+
+    // Functions used to parse the whole csv
+    // data in one forward pass into typed
+    // columns (one per (projected) column),
+    // each stored in the natural width of its
+    // type and parsed with a converter suited
+    // to it, the types are either provided or
+    // inferred from a sample of the first
+    // data rows (and widened if needed, see
+    // inferColumnTypes)
+    // The functions return the number of
+    // data points parsed
+
+    std::size_t                                                         materializeColumns(std::vector<blCSVTypedColumn>& columns,
+                                                                                           const std::vector<blColumnType>& columnTypes)const;
+
+    std::size_t                                                         materializeColumns(std::vector<blCSVTypedColumn>& columns,
+                                                                                           const std::ptrdiff_t& numberOfRowsToSample = 100)const;
+
+
+
+    // Function used to compute the statistics
+    // of every (projected) column (count, NaN
+    // count, min, max, mean, variance and an
+    // estimate of the number of distinct values)
+    // in one scan of the csv data, split into
+    // chunks of whole rows processed concurrently
+    // whose partial statistics are then merged
+    // Fields that are not numbers (for ex. NaN
+    // or NA) are counted as NaNs
+    // A number of threads equal to zero means
+    // using as many threads as the hardware
+    // supports
+    // The function returns the number of
+    // fields visited
+
+    std::size_t                                                         computeColumnStatistics(std::vector<blColumnStatistics>& columnStatistics,
+                                                                                                const std::size_t& numberOfThreads = 0)const;
+
+
+
+    // Function used to filter the data rows
+    // while scanning the csv data, only the
+    // fields of the specified key columns
+    // are converted and the predicate is
+    // called with their values (in the order
+    // of the key columns) for every data row
+    // The indexes of the accepted rows are
+    // written to the selection vector in
+    // increasing order
+    // The csv data is split into chunks of
+    // whole rows processed concurrently, so
+    // the predicate has to be safe to call
+    // from multiple threads
+    // A number of threads equal to zero means
+    // using as many threads as the hardware
+    // supports
+    // The function returns the number of
+    // selected rows (zero when a key column
+    // is out of range or repeated)
+    //
+    // NOTE:  The predicate is called as
+    //        bool(const std::vector<blNumberType>&)
+
+    template<typename blRowPredicateType>
+    std::size_t                                                         selectRows(const std::vector<std::ptrdiff_t>& keyColIndexes,
+                                                                                   const blRowPredicateType& rowPredicate,
+                                                                                   std::vector<std::ptrdiff_t>& selectedRowIndexes,
+                                                                                   const std::size_t& numberOfThreads = 0)const;
+
+
+
+    // Function used to parse only the
+    // specified data rows (for ex. the ones
+    // selected by the above function) into a
+    // filtered matrix with one row per
+    // specified row, the other rows are
+    // never converted
+    // Increasing row indexes are found in one
+    // forward scan, or straight away when the
+    // row index is built
+    // The function returns the number of
+    // data points written
+
+    template<typename blAllocatorType>
+    std::size_t                                                         materializeRows(const std::vector<std::ptrdiff_t>& rowIndexes,
+                                                                                        std::vector<blNumberType,blAllocatorType>& matrix,
+                                                                                        const blAdvancingIteratorMethod& outputLayout = ROW_MAJOR)const;
+
+
+
+    // Functions used to get a view of a
+    // data row, holding the byte range of
+    // the row and the offsets of its fields
+    // (see blCSVRowView), the second one
+    // reuses the storage of the provided
+    // view and returns false (leaving it
+    // empty) when the row does not exist
+    // The row is found straight away when
+    // the row index is built, otherwise
+    // the csv data is scanned from the
+    // closest data point checkpoint (or
+    // from the first data point)
+
+    blCSVRowView<blDataIteratorType,blNumberType,blNumberConverterType>                 row(const std::ptrdiff_t& rowIndex)const;
+    bool                                                                                row(const std::ptrdiff_t& rowIndex,
+                                                                                            blCSVRowView<blDataIteratorType,blNumberType,blNumberConverterType>& rowView)const;
 
 
 
@@ -315,19 +856,324 @@ private: // Static functions/variables/constants
 
 
 
+    // The token used to quote fields
+
+    const static char                                                   s_quoteToken;
+
+
+
+    // Tag ("BLCSVIDX" read as a little
+    // endian integer) and version written
+    // at the beginning of an index
+
+    const static std::uint64_t                                          s_indexTag;
+    const static std::uint64_t                                          s_indexVersion;
+
+
+
 protected: // Protected functions
 
 
 
-    // Virtual function used to convert
-    // the text we're currently pointing
-    // to into a number
-    // This function is virtual, which means
-    // that a derived class could override
-    // it to convert the text however they
-    // desire
+    // Function used to convert the text
+    // we're currently pointing to into a
+    // number, using the number converter
+
+    void                                                                convertToNumberFromCurrentPosition();
+
+
+
+    // Function used to make sure that the
+    // layout is not shared with copies of
+    // this iterator before changing it
+
+    void                                                                makeLayoutUnique();
+
+
+
+    // Functions used to apply the column
+    // projection to the layout, and to
+    // get the index (counted in the csv
+    // data) of a projected column or of
+    // a projected data point
+
+    void                                                                applyColumnProjection();
+
+    std::ptrdiff_t                                                      getColIndexInData(const std::ptrdiff_t& colIndex)const;
+
+    std::ptrdiff_t                                                      getDataIndexInData(const std::ptrdiff_t& rowIndex,
+                                                                                           const std::ptrdiff_t& colIndex)const;
+
+
+
+    // Function used by the copy constructor
+    // and the assignment operator
+
+    void                                                                copyFrom(const blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>& csvMatrixIterator);
+
+
+
+    // Function used to point the
+    // iterator to the first data
+    // point (without converting it)
+
+    void                                                                pointToTheFirstDataPoint();
+
+
+
+    // Function used (in the ragged rows
+    // mode) to point the iterator to the
+    // specified row and column (without
+    // converting it), using the row index
+    // A missing data point is pointed to
+    // the beginning of its row
+
+    void                                                                pointToDataPointInRaggedRows(const std::ptrdiff_t& newRowIndex,
+                                                                                                 const std::ptrdiff_t& newColIndex);
+
+
+
+    // Function used to move the iterator
+    // to the specified data point (counted
+    // in a row-major way) by starting the
+    // scan from the closest known position
+    // before it, which can be the current
+    // position, the beginning of its row
+    // (row index) or the closest data point
+    // checkpoint
+
+    void                                                                moveIteratorUsingIndexes(const std::ptrdiff_t& newDataIndex);
+
+
+
+    // Functions used to move the iterator
+    // to the specified row and column by
+    // continuing the scan from where we
+    // last left off in that row, this is
+    // what makes column-major traversal
+    // linear in the size of the data
+    // The first column-major move of an
+    // iterator (or of a copy of it) is done
+    // without cursors, so one-off jumps and
+    // temporaries never build them
+
+    void                                                                buildRowCursors();
+
+    void                                                                moveIteratorUsingRowCursors(const std::ptrdiff_t& newRowIndex,
+                                                                                                const std::ptrdiff_t& newColIndex);
+
+
+
+    // Functions used to find, count and
+    // record the offsets of the fields
+    // separated by the specified tokens,
+    // they skip tokens inside quoted
+    // fields when the csv data has any
+    // and otherwise use the faster
+    // quote-unaware algorithms
+    // Zero length fields are never counted
+    // The ones called the most take the
+    // token scanners of the layout, so
+    // that they are built only once
+
+    template<typename blIntegerType>
+    blIntegerType                                                       findBeginningOfNthField(const blDataIteratorType& beginIter,
+                                                                                                const blDataIteratorType& endIter,
+                                                                                                const blSIMDTokenScanner& tokenScanner,
+                                                                                                const blIntegerType& whichFieldToFind,
+                                                                                                blDataIteratorType& nthFieldBeginIter)const;
+
+    template<typename blIntegerType>
+    blIntegerType                                                       findBeginAndEndOfNthField(const blDataIteratorType& beginIter,
+                                                                                                  const blDataIteratorType& endIter,
+                                                                                                  const std::string& tokens,
+                                                                                                  const blIntegerType& whichFieldToFind,
+                                                                                                  blDataIteratorType& nthFieldBeginIter,
+                                                                                                  blDataIteratorType& nthFieldEndIter)const;
+
+    std::size_t                                                         countFields(const blDataIteratorType& beginIter,
+                                                                                    const blDataIteratorType& endIter,
+                                                                                    const blSIMDTokenScanner& tokenScanner)const;
 
-    virtual void                                                        convertToNumberFromCurrentPosition();
+    std::size_t                                                         findOffsetsOfAllFields(const blDataIteratorType& beginIter,
+                                                                                               const blDataIteratorType& endIter,
+                                                                                               const std::string& tokens,
+                                                                                               std::vector<std::ptrdiff_t>& fieldOffsets)const;
+
+    std::ptrdiff_t                                                      findOffsetsOfEveryNthField(const blDataIteratorType& beginIter,
+                                                                                                   const blDataIteratorType& endIter,
+                                                                                                   const std::string& tokens,
+                                                                                                   const std::ptrdiff_t& intervalBetweenRecordedFields,
+                                                                                                   std::vector<std::ptrdiff_t>& fieldOffsets)const;
+
+
+
+    // Function used to copy the contents
+    // of a quoted field (the iterator points
+    // to its opening quote) without the
+    // quotes and with escaped quotes ("")
+    // turned into single quotes
+    // It returns an iterator pointing to
+    // the place right after the closing quote
+
+    static blDataIteratorType                                           copyQuotedField(const blDataIteratorType& fieldBeginIter,
+                                                                                        const blDataIteratorType& endIter,
+                                                                                        std::string& fieldContents);
+
+
+
+    // Function used to copy the contents
+    // of the field starting at the specified
+    // position (unquoting it if needed)
+    // It returns an iterator pointing to
+    // the place right after the field
+
+    blDataIteratorType                                                  copyField(const blDataIteratorType& fieldBeginIter,
+                                                                                  std::string& fieldContents)const;
+
+
+
+    // Function used to copy the contents
+    // of a quoted number without the quotes
+    // and without any column tokens in it
+    // (for ex. the thousands separator in
+    // "1,234.5")
+    // It returns an iterator pointing to
+    // the place right after the closing quote
+
+    blDataIteratorType                                                  copyQuotedNumber(const blDataIteratorType& fieldBeginIter,
+                                                                                         std::string& fieldContents)const;
+
+
+
+    // Function used to convert the field
+    // starting at the specified position
+    // into a number, unquoting it first
+    // if needed
+    // It returns an iterator pointing to
+    // the place right after the characters
+    // used for the conversion
+
+    template<typename blFieldNumberType>
+    blDataIteratorType                                                  convertFieldToNumber(const blDataIteratorType& fieldBeginIter,
+                                                                                             blFieldNumberType& number)const;
+
+
+
+    // Same as the above function, but the
+    // field is converted into an integer
+    // (any decimal digits are dropped)
+
+    template<typename blIntegerType>
+    blDataIteratorType                                                  convertFieldToInteger(const blDataIteratorType& fieldBeginIter,
+                                                                                              blIntegerType& integer)const;
+
+
+
+    // Same as the above functions, but also
+    // telling whether the whole field was a
+    // number (an integer that fit the type
+    // for the integer version), an empty
+    // field counts as a zero
+
+    template<typename blFieldNumberType>
+    blDataIteratorType                                                  convertFieldToNumber(const blDataIteratorType& fieldBeginIter,
+                                                                                             blFieldNumberType& number,
+                                                                                             bool& isFieldANumber)const;
+
+    template<typename blIntegerType>
+    blDataIteratorType                                                  convertFieldToInteger(const blDataIteratorType& fieldBeginIter,
+                                                                                              blIntegerType& integer,
+                                                                                              bool& isFieldANumber)const;
+
+
+
+    // Function used (when materializing
+    // typed columns) to convert a field
+    // that doesn't fit the type of its
+    // column, which either widens the
+    // column or marks the row as one
+    // whose field is not a number
+
+    blDataIteratorType                                                  convertFieldWideningColumn(const blDataIteratorType& fieldBeginIter,
+                                                                                                   const std::ptrdiff_t& rowIndex,
+                                                                                                   blCSVTypedColumn& column)const;
+
+
+
+    // Function used to visit the fields of
+    // consecutive data rows starting from
+    // the specified position (which has to
+    // be the beginning of a row), calling
+    // the functor with the row index, the
+    // (projected) column index and the
+    // beginning of each field
+    // The functor returns an iterator
+    // pointing to where it stopped reading
+    // the field and the fields are visited
+    // in the order they appear in the csv
+    // data (so not in the projected order
+    // when columns are projected)
+    // It returns the number of fields
+    // visited
+
+    template<typename blFieldFunctorType>
+    std::size_t                                                         forEachField(const blDataIteratorType& beginIter,
+                                                                                     const blDataIteratorType& endIter,
+                                                                                     const std::ptrdiff_t& firstRowIndex,
+                                                                                     const std::ptrdiff_t& numberOfRows,
+                                                                                     blFieldFunctorType& fieldFunctor)const;
+
+
+
+    // Same as the above function, but only
+    // the specified columns are visited, each
+    // given as a pair of its index in the csv
+    // data and the column index passed to the
+    // functor, sorted by (and without repeating)
+    // their index in the csv data
+
+    template<typename blFieldFunctorType>
+    std::size_t                                                         forEachFieldOfColumns(const blDataIteratorType& beginIter,
+                                                                                              const blDataIteratorType& endIter,
+                                                                                              const std::ptrdiff_t& firstRowIndex,
+                                                                                              const std::ptrdiff_t& numberOfRows,
+                                                                                              const std::vector< std::pair<std::ptrdiff_t,std::ptrdiff_t> >& colsInDataOrder,
+                                                                                              blFieldFunctorType& fieldFunctor)const;
+
+
+
+    // Function used to parse the data points
+    // of consecutive data rows starting from
+    // the specified position (which has to
+    // be the beginning of a row), calling the
+    // functor with the row-major index and
+    // the value of each data point parsed,
+    // in row-major order
+    // It returns the number of data
+    // points parsed
+
+    template<typename blFunctorType>
+    std::size_t                                                         parseDataPoints(const blDataIteratorType& beginIter,
+                                                                                        const blDataIteratorType& endIter,
+                                                                                        const std::ptrdiff_t& firstRowIndex,
+                                                                                        const std::ptrdiff_t& numberOfRows,
+                                                                                        blFunctorType& functor)const;
+
+
+
+    // Function used to split the csv data
+    // into chunks of whole rows and to call
+    // the functor concurrently for every
+    // chunk, passing it the chunk index, the
+    // chunk's begin/end iterators, the global
+    // index of the chunk's first row and the
+    // number of rows in the chunk
+    // It returns the number of chunks used
+
+    template<typename blChunkFunctorType>
+    std::size_t                                                         forEachRowAlignedChunkInParallel(const std::size_t& numberOfThreads,
+                                                                                                         const blChunkFunctorType& chunkFunctor)const;
 
 
 
@@ -368,6 +1214,20 @@ protected: // Protected variables
 
 
 
+    // The value of the data points
+    // missing from ragged rows
+
+    blNumberType                                                        m_missingValue;
+
+
+
+    // The policy used to convert
+    // the fields into numbers
+
+    blNumberConverterType                                               m_numberConverter;
+
+
+
     // Current row and column indexes
     // of where in the csv matrix data
     // the iterator is pointing at as well
@@ -380,53 +1240,72 @@ protected: // Protected variables
 
 
 
-    // Total number of data rows
-    // and columns per row in the
-    // csv data
+    // Variable used to decide how to advance
+    // the iterator
 
-    std::ptrdiff_t                                                      m_rows;
-    std::ptrdiff_t                                                      m_cols;
+    blAdvancingIteratorMethod                                           m_advancingIteratorMethod;
 
 
 
-    // Total size of matrix (rows * cols)
+    // The layout of the csv data (tokens,
+    // dimensions, column names, row index
+    // and checkpoints), shared between
+    // copies of this iterator so that
+    // copying it never allocates
+    // A shared layout is never changed,
+    // we first make our own copy of it
 
-    std::size_t                                                         m_size;
+    std::shared_ptr<blCSVMatrixLayout>                                  m_layout;
 
 
 
-    // Tokens used to look for rows
-    // and columns in the csv data
+    // Cursors (one per row) used when
+    // advancing in a column-major way
+    // They belong to this iterator only,
+    // copies don't get them, and they're
+    // only built the second time the
+    // iterator moves in a column-major way
+    // (a single jump doesn't need them)
 
-    std::string                                                         m_rowTokens;
-    std::string                                                         m_colTokens;
-    std::string                                                         m_rowAndColTokensCombined;
+    std::unique_ptr<blCSVRowCursors>                                    m_rowCursors;
+    bool                                                                m_hasMovedInColumnMajorWay;
+};
+//-------------------------------------------------------------------
 
 
 
-    // Variable used to decide how to advance
-    // the iterator
+//-------------------------------------------------------------------
+// Static constants definitions
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
 
-    blAdvancingIteratorMethod                                           m_advancingIteratorMethod;
+const std::string blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::s_digits = "-+.0123456789";
 
 
 
-    // Vector of strings holding
-    // the column names
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
 
-    std::vector<std::string>                                            m_columnNames;
-};
-//-------------------------------------------------------------------
+const char blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::s_quoteToken = '"';
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+const std::uint64_t blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::s_indexTag = 0x5844495653434C42ull;
 
 
 
-//-------------------------------------------------------------------
-// Static constants definitions
-//-------------------------------------------------------------------
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-const std::string blCSVMatrixIterator<blDataIteratorType,blNumberType>::s_digits = "-+.0123456789";
+const std::uint64_t blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::s_indexVersion = 4;
 //-------------------------------------------------------------------
 
 
@@ -435,18 +1314,41 @@ const std::string blCSVMatrixIterator<blDataIteratorType,blNumberType>::s_digits
 // Constructor from two iterators and token strings
 //-------------------------------------------------------------------
 template<typename blDataIteratorType,
-         typename blNumberType>
-
-inline blCSVMatrixIterator<blDataIteratorType,blNumberType>::blCSVMatrixIterator(const blDataIteratorType& beginIter,
-                                                                                 const blDataIteratorType& endIter,
-                                                                                 const std::string rowTokens,
-                                                                                 const std::string colTokens,
-                                                                                 const blAdvancingIteratorMethod& advancingIteratorMethod)
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::blCSVMatrixIterator(const blDataIteratorType& beginIter,
+                                                                                                       const blDataIteratorType& endIter,
+                                                                                                       const std::string rowTokens,
+                                                                                                       const std::string colTokens,
+                                                                                                       const blAdvancingIteratorMethod& advancingIteratorMethod,
+                                                                                                       const bool& shouldRowIndexBeBuilt,
+                                                                                                       const std::ptrdiff_t& dataPointCheckpointInterval,
+                                                                                                       const std::string& indexFilePath,
+                                                                                                       const bool& shouldRaggedRowsBeHandled,
+                                                                                                       const std::vector<std::string>& commentPrefixes,
+                                                                                                       const std::ptrdiff_t& numberOfHeaderRows)
 {
+    m_layout = std::make_shared<blCSVMatrixLayout>();
+
+    m_hasMovedInColumnMajorWay = false;
+
+    m_layout->m_shouldRowIndexBeBuilt = shouldRowIndexBeBuilt;
+    m_layout->m_dataPointCheckpointInterval = dataPointCheckpointInterval;
+
+    if(std::numeric_limits<blNumberType>::has_quiet_NaN)
+        m_missingValue = std::numeric_limits<blNumberType>::quiet_NaN();
+    else
+        m_missingValue = blNumberType(0);
+
     setIterators(beginIter,
                  endIter,
                  rowTokens,
-                 colTokens);
+                 colTokens,
+                 indexFilePath,
+                 shouldRaggedRowsBeHandled,
+                 commentPrefixes,
+                 numberOfHeaderRows);
 
     setAdvancingIteratorMethod(advancingIteratorMethod);
 }
@@ -454,13 +1356,73 @@ inline blCSVMatrixIterator<blDataIteratorType,blNumberType>::blCSVMatrixIterator
 
 
 
+//-------------------------------------------------------------------
+// Copy constructor and assignment operator
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::blCSVMatrixIterator(const blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>& csvMatrixIterator)
+{
+    copyFrom(csvMatrixIterator);
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>& blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::operator=(const blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>& csvMatrixIterator)
+{
+    if(this != &csvMatrixIterator)
+        copyFrom(csvMatrixIterator);
+
+    return (*this);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to copy another iterator, which
+// shares its layout but not its row cursors
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline void blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::copyFrom(const blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>& csvMatrixIterator)
+{
+    m_beginIter = csvMatrixIterator.m_beginIter;
+    m_endIter = csvMatrixIterator.m_endIter;
+    m_iter = csvMatrixIterator.m_iter;
+    m_firstDataPointIter = csvMatrixIterator.m_firstDataPointIter;
+    m_number = csvMatrixIterator.m_number;
+    m_missingValue = csvMatrixIterator.m_missingValue;
+    m_numberConverter = csvMatrixIterator.m_numberConverter;
+    m_rowIndex = csvMatrixIterator.m_rowIndex;
+    m_colIndex = csvMatrixIterator.m_colIndex;
+    m_dataIndex = csvMatrixIterator.m_dataIndex;
+    m_advancingIteratorMethod = csvMatrixIterator.m_advancingIteratorMethod;
+    m_layout = csvMatrixIterator.m_layout;
+
+    m_rowCursors.reset();
+    m_hasMovedInColumnMajorWay = false;
+}
+//-------------------------------------------------------------------
+
+
+
 //-------------------------------------------------------------------
 // Destructor
 //-------------------------------------------------------------------
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline blCSVMatrixIterator<blDataIteratorType,blNumberType>::~blCSVMatrixIterator()
+inline blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::~blCSVMatrixIterator()
 {
 }
 //-------------------------------------------------------------------
@@ -471,21 +1433,35 @@ inline blCSVMatrixIterator<blDataIteratorType,blNumberType>::~blCSVMatrixIterato
 // Comparison operators
 //-------------------------------------------------------------------
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline bool blCSVMatrixIterator<blDataIteratorType,blNumberType>::operator==(const blCSVMatrixIterator<blDataIteratorType,blNumberType>& csvMatrixIterator)const
+inline bool blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::operator==(const blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>& csvMatrixIterator)const
 {
+    // In the ragged rows mode, the missing
+    // data points of a row all point to the
+    // beginning of the row, so we also
+    // compare the indexes
+
+    if(areRowFieldCountsBuilt())
+    {
+        return (m_iter == csvMatrixIterator.getIter() &&
+                m_rowIndex == csvMatrixIterator.rowIndex() &&
+                m_colIndex == csvMatrixIterator.colIndex());
+    }
+
     return (m_iter == csvMatrixIterator.getIter());
 }
 
 
 
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline bool blCSVMatrixIterator<blDataIteratorType,blNumberType>::operator!=(const blCSVMatrixIterator<blDataIteratorType,blNumberType>& csvMatrixIterator)const
+inline bool blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::operator!=(const blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>& csvMatrixIterator)const
 {
-    return (m_iter != csvMatrixIterator.getIter());
+    return !((*this) == csvMatrixIterator);
 }
 //-------------------------------------------------------------------
 
@@ -495,9 +1471,10 @@ inline bool blCSVMatrixIterator<blDataIteratorType,blNumberType>::operator!=(con
 // Access operators and functions
 //-------------------------------------------------------------------
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline const blNumberType& blCSVMatrixIterator<blDataIteratorType,blNumberType>::operator[](const std::ptrdiff_t& index)
+inline const blNumberType& blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::operator[](const std::ptrdiff_t& index)
 {
     moveIterator(index - m_dataIndex,m_advancingIteratorMethod);
     return m_number;
@@ -506,9 +1483,10 @@ inline const blNumberType& blCSVMatrixIterator<blDataIteratorType,blNumberType>:
 
 
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline const blNumberType& blCSVMatrixIterator<blDataIteratorType,blNumberType>::operator()(const std::ptrdiff_t& index)
+inline const blNumberType& blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::operator()(const std::ptrdiff_t& index)
 {
     moveIterator(index - m_dataIndex,m_advancingIteratorMethod);
     return m_number;
@@ -517,9 +1495,10 @@ inline const blNumberType& blCSVMatrixIterator<blDataIteratorType,blNumberType>:
 
 
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline const blNumberType& blCSVMatrixIterator<blDataIteratorType,blNumberType>::at(const std::ptrdiff_t& index)
+inline const blNumberType& blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::at(const std::ptrdiff_t& index)
 {
     moveIterator(index - m_dataIndex,m_advancingIteratorMethod);
     return m_number;
@@ -528,12 +1507,13 @@ inline const blNumberType& blCSVMatrixIterator<blDataIteratorType,blNumberType>:
 
 
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline const blNumberType& blCSVMatrixIterator<blDataIteratorType,blNumberType>::operator()(const std::ptrdiff_t& rowIndex,
-                                                                                            const std::ptrdiff_t& colIndex)
+inline const blNumberType& blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::operator()(const std::ptrdiff_t& rowIndex,
+                                                                                                                  const std::ptrdiff_t& colIndex)
 {
-    std::ptrdiff_t index = rowIndex * m_cols + colIndex;
+    std::ptrdiff_t index = rowIndex * m_layout->m_cols + colIndex;
     moveIterator(index - m_dataIndex,ROW_MAJOR);
     return m_number;
 }
@@ -541,12 +1521,13 @@ inline const blNumberType& blCSVMatrixIterator<blDataIteratorType,blNumberType>:
 
 
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline const blNumberType& blCSVMatrixIterator<blDataIteratorType,blNumberType>::at(const std::ptrdiff_t& rowIndex,
-                                                                                    const std::ptrdiff_t& colIndex)
+inline const blNumberType& blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::at(const std::ptrdiff_t& rowIndex,
+                                                                                                          const std::ptrdiff_t& colIndex)
 {
-    std::ptrdiff_t index = rowIndex * m_cols + colIndex;
+    std::ptrdiff_t index = rowIndex * m_layout->m_cols + colIndex;
     moveIterator(index - m_dataIndex,ROW_MAJOR);
     return m_number;
 }
@@ -558,9 +1539,10 @@ inline const blNumberType& blCSVMatrixIterator<blDataIteratorType,blNumberType>:
 // Reference and Dereference operators
 //-------------------------------------------------------------------
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline blNumberType* blCSVMatrixIterator<blDataIteratorType,blNumberType>::operator->()
+inline blNumberType* blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::operator->()
 {
     return &m_number;
 }
@@ -568,9 +1550,10 @@ inline blNumberType* blCSVMatrixIterator<blDataIteratorType,blNumberType>::opera
 
 
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline const blNumberType& blCSVMatrixIterator<blDataIteratorType,blNumberType>::operator*()const
+inline const blNumberType& blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::operator*()const
 {
     return m_number;
 }
@@ -583,23 +1566,99 @@ inline const blNumberType& blCSVMatrixIterator<blDataIteratorType,blNumberType>:
 // the token strings
 //-------------------------------------------------------------------
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline void blCSVMatrixIterator<blDataIteratorType,blNumberType>::setIterators(const blDataIteratorType& beginIter,
-                                                                               const blDataIteratorType& endIter,
-                                                                               const std::string& rowTokens,
-                                                                               const std::string& colTokens)
+inline void blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::setIterators(const blDataIteratorType& beginIter,
+                                                                                                     const blDataIteratorType& endIter,
+                                                                                                     const std::string& rowTokens,
+                                                                                                     const std::string& colTokens)
 {
-    m_beginIter = beginIter;
-    m_endIter = endIter;
-    m_iter = m_beginIter;
-    m_firstDataPointIter = m_beginIter;
-
+    setIterators(beginIter,
+                 endIter,
+                 rowTokens,
+                 colTokens,
+                 std::string());
+}
 
 
-    m_rowTokens = rowTokens;
-    m_colTokens = colTokens;
-    m_rowAndColTokensCombined = m_rowTokens + m_colTokens;
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline void blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::setIterators(const blDataIteratorType& beginIter,
+                                                                                                     const blDataIteratorType& endIter,
+                                                                                                     const std::string& rowTokens,
+                                                                                                     const std::string& colTokens,
+                                                                                                     const std::string& indexFilePath,
+                                                                                                     const bool& shouldRaggedRowsBeHandled,
+                                                                                                     const std::vector<std::string>& commentPrefixes,
+                                                                                                     const std::ptrdiff_t& numberOfHeaderRows)
+{
+    // The settings are applied before
+    // the csv data is scanned, so that
+    // it is only scanned once
+
+    makeLayoutUnique();
+
+    m_layout->m_shouldRaggedRowsBeHandled = shouldRaggedRowsBeHandled;
+
+    if(shouldRaggedRowsBeHandled)
+        m_layout->m_shouldRowIndexBeBuilt = true;
+
+    m_layout->m_commentPrefixes = commentPrefixes;
+    m_layout->m_numberOfHeaderRows = std::max(numberOfHeaderRows,std::ptrdiff_t(-1));
+
+    setIterators(beginIter,
+                 endIter,
+                 rowTokens,
+                 colTokens,
+                 indexFilePath);
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline void blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::setIterators(const blDataIteratorType& beginIter,
+                                                                                                     const blDataIteratorType& endIter,
+                                                                                                     const std::string& rowTokens,
+                                                                                                     const std::string& colTokens,
+                                                                                                     const std::string& indexFilePath)
+{
+    m_beginIter = beginIter;
+    m_endIter = endIter;
+    m_iter = m_beginIter;
+    m_firstDataPointIter = m_beginIter;
+
+
+
+    // The current layout might be shared
+    // with copies of this iterator, so we
+    // start a new one, keeping only the
+    // user's settings
+
+    auto layout = std::make_shared<blCSVMatrixLayout>();
+
+    layout->m_rowTokens = rowTokens;
+    layout->m_colTokens = colTokens;
+    layout->m_rowAndColTokensCombined = rowTokens + colTokens;
+    layout->m_rowAndColTokenSet = blTokenSet(layout->m_rowAndColTokensCombined);
+    layout->m_rowTokenScanner = blSIMDTokenScanner(rowTokens);
+    layout->m_colTokenScanner = blSIMDTokenScanner(colTokens);
+    layout->m_rowAndColTokenScanner = blSIMDTokenScanner(layout->m_rowAndColTokensCombined);
+    layout->m_quoteTokenScanner = blSIMDTokenScanner(&s_quoteToken,&s_quoteToken + 1);
+    layout->m_shouldRowIndexBeBuilt = m_layout->m_shouldRowIndexBeBuilt;
+    layout->m_shouldRaggedRowsBeHandled = m_layout->m_shouldRaggedRowsBeHandled;
+    layout->m_dataPointCheckpointInterval = m_layout->m_dataPointCheckpointInterval;
+    layout->m_commentPrefixes = m_layout->m_commentPrefixes;
+    layout->m_numberOfHeaderRows = m_layout->m_numberOfHeaderRows;
+    layout->m_projectedColIndexes = m_layout->m_projectedColIndexes;
+
+    m_layout = std::move(layout);
 
 
 
@@ -607,7 +1666,27 @@ inline void blCSVMatrixIterator<blDataIteratorType,blNumberType>::setIterators(c
 
 
 
-    calculateTotalNumberOfRowsAndColumns();
+    // When an index file is used, we
+    // try loading the layout from it and
+    // only scan the csv data (and rewrite
+    // the index file) if that fails
+    // The index file always holds a row
+    // index, since finding the rows is
+    // what makes scanning slow
+
+    if(!indexFilePath.empty())
+        m_layout->m_shouldRowIndexBeBuilt = true;
+
+    if(indexFilePath.empty())
+    {
+        calculateTotalNumberOfRowsAndColumns();
+    }
+    else if(!loadIndex(indexFilePath))
+    {
+        calculateTotalNumberOfRowsAndColumns();
+
+        saveIndex(indexFilePath);
+    }
 
     convertToNumberFromCurrentPosition();
 }
@@ -620,36 +1699,39 @@ inline void blCSVMatrixIterator<blDataIteratorType,blNumberType>::setIterators(c
 // token strings
 //-------------------------------------------------------------------
 template<typename blDataIteratorType,
-          typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline void blCSVMatrixIterator<blDataIteratorType,blNumberType>::setRowTokens(const std::string& rowTokens)
+inline void blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::setRowTokens(const std::string& rowTokens)
 {
     setIterators(m_beginIter,
                  m_endIter,
                  rowTokens,
-                 m_colTokens);
+                 m_layout->m_colTokens);
 }
 
 
 
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline void blCSVMatrixIterator<blDataIteratorType,blNumberType>::setColTokens(const std::string& colTokens)
+inline void blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::setColTokens(const std::string& colTokens)
 {
     setIterators(m_beginIter,
                  m_endIter,
-                 m_rowTokens,
+                 m_layout->m_rowTokens,
                  colTokens);
 }
 
 
 
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline void blCSVMatrixIterator<blDataIteratorType,blNumberType>::setRowAndColTokens(const std::string& rowTokens,
-                                                                                     const std::string& colTokens)
+inline void blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::setRowAndColTokens(const std::string& rowTokens,
+                                                                                                           const std::string& colTokens)
 {
     setIterators(m_beginIter,
                  m_endIter,
@@ -660,15 +1742,16 @@ inline void blCSVMatrixIterator<blDataIteratorType,blNumberType>::setRowAndColTo
 
 
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline void blCSVMatrixIterator<blDataIteratorType,blNumberType>::setIterators(const blDataIteratorType& beginIter,
-                                                                               const blDataIteratorType& endIter)
+inline void blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::setIterators(const blDataIteratorType& beginIter,
+                                                                                                     const blDataIteratorType& endIter)
 {
     setIterators(beginIter,
                  endIter,
-                 m_rowTokens,
-                 m_colTokens);
+                 m_layout->m_rowTokens,
+                 m_layout->m_colTokens);
 }
 //-------------------------------------------------------------------
 
@@ -679,10 +1762,11 @@ inline void blCSVMatrixIterator<blDataIteratorType,blNumberType>::setIterators(c
 // in a column-major way
 //-------------------------------------------------------------------
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline void blCSVMatrixIterator<blDataIteratorType,blNumberType>::moveIterator(std::ptrdiff_t movement,
-                                                                               const blAdvancingIteratorMethod& advancingIteratorMethod)
+inline void blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::moveIterator(std::ptrdiff_t movement,
+                                                                                                     const blAdvancingIteratorMethod& advancingIteratorMethod)
 {
     // If we need to move in a column major
     // way we need to change the movement
@@ -692,53 +1776,108 @@ inline void blCSVMatrixIterator<blDataIteratorType,blNumberType>::moveIterator(s
     {
         // First we calculate the current index
         // in terms of column major counting
+        // (when pointing to the end, the index
+        // is simply the size of the matrix)
+
+        std::ptrdiff_t dataIndex = m_colIndex * m_layout->m_rows + m_rowIndex;
+
+        if(m_dataIndex >= static_cast<std::ptrdiff_t>(m_layout->m_size))
+            dataIndex = m_layout->m_size;
 
-        std::ptrdiff_t dataIndex = m_colIndex * m_rows + m_rowIndex;
         dataIndex += movement;
 
         if(dataIndex < 0)
         {
-            m_iter = m_firstDataPointIter;
-            m_rowIndex = 0;
-            m_colIndex = 0;
-            m_dataIndex = 0;
-
+            moveToTheBeginning();
             return;
         }
-        else if(dataIndex >= m_size)
+        else if(dataIndex >= static_cast<std::ptrdiff_t>(m_layout->m_size))
         {
-            m_iter = m_endIter;
-            m_rowIndex = m_rows;
-            m_colIndex = m_cols;
-            m_dataIndex = m_size;
+            moveToTheEnd();
+            return;
+        }
+
+        std::ptrdiff_t newColIndex = dataIndex / m_layout->m_rows;
+        std::ptrdiff_t newRowIndex = dataIndex % m_layout->m_rows;
+
+        if(movement != 0 && areRowFieldCountsBuilt())
+        {
+            pointToDataPointInRaggedRows(newRowIndex,newColIndex);
+            convertToNumberFromCurrentPosition();
+            return;
+        }
 
+        if(movement != 0)
+        {
+            moveIteratorUsingRowCursors(newRowIndex,newColIndex);
             return;
         }
+    }
+
+
+
+    // In the ragged rows mode, the data
+    // points are found from the beginning
+    // of their row
+
+    if(movement != 0 && areRowFieldCountsBuilt())
+    {
+        std::ptrdiff_t newDataIndex = m_dataIndex + movement;
+
+        if(newDataIndex < 0)
+        {
+            moveToTheBeginning();
+        }
+        else if(newDataIndex >= static_cast<std::ptrdiff_t>(m_layout->m_size))
+        {
+            moveToTheEnd();
+        }
+        else
+        {
+            pointToDataPointInRaggedRows(newDataIndex / m_layout->m_cols,
+                                         newDataIndex % m_layout->m_cols);
+
+            convertToNumberFromCurrentPosition();
+        }
+
+        return;
+    }
 
-        std::ptrdiff_t newColIndex = dataIndex / m_rows;
-        std::ptrdiff_t newRowIndex = dataIndex % m_rows;
 
-        movement = (newRowIndex * m_cols + newColIndex) - m_dataIndex;
+
+    // If we have a row index or data point
+    // checkpoints we let them decide where
+    // to start scanning from instead of
+    // always scanning from the current
+    // position or from the first data point
+    // The same goes for projected columns,
+    // since a move has to skip over the
+    // unselected fields
+
+    if(movement != 0 &&
+       m_layout->m_cols > 0 &&
+       (isRowIndexBuilt() || areDataPointCheckpointsBuilt() || isColumnProjected()))
+    {
+        moveIteratorUsingIndexes(m_dataIndex + movement);
+        return;
     }
 
 
 
     if(movement > 0)
     {
-        int actualMovement = findBeginningOfNthDataPoint(m_iter,
-                                                         m_endIter,
-                                                         m_rowAndColTokensCombined.begin(),
-                                                         m_rowAndColTokensCombined.end(),
-                                                         false,
-                                                         movement,
-                                                         m_iter);
+        int actualMovement = findBeginningOfNthField(m_iter,
+                                                     m_endIter,
+                                                     m_layout->m_rowAndColTokenScanner,
+                                                     movement,
+                                                     m_iter);
 
         if(actualMovement < movement)
             m_iter = m_endIter;
 
         m_dataIndex += actualMovement;
-        m_rowIndex = m_dataIndex / m_cols;
-        m_colIndex = m_dataIndex % m_cols;
+        m_rowIndex = m_dataIndex / m_layout->m_cols;
+        m_colIndex = m_dataIndex % m_layout->m_cols;
 
         convertToNumberFromCurrentPosition();
     }
@@ -757,16 +1896,14 @@ inline void blCSVMatrixIterator<blDataIteratorType,blNumberType>::moveIterator(s
         }
         else
         {
-            m_dataIndex = findBeginningOfNthDataPoint(m_firstDataPointIter,
-                                                      m_endIter,
-                                                      m_rowAndColTokensCombined.begin(),
-                                                      m_rowAndColTokensCombined.end(),
-                                                      false,
-                                                      newDataPointToFind,
-                                                      m_iter);
-
-            m_rowIndex = m_dataIndex / m_cols;
-            m_colIndex = m_dataIndex % m_cols;
+            m_dataIndex = findBeginningOfNthField(m_firstDataPointIter,
+                                                  m_endIter,
+                                                  m_layout->m_rowAndColTokenScanner,
+                                                  newDataPointToFind,
+                                                  m_iter);
+
+            m_rowIndex = m_dataIndex / m_layout->m_cols;
+            m_colIndex = m_dataIndex % m_layout->m_cols;
         }
 
 
@@ -783,480 +1920,4135 @@ inline void blCSVMatrixIterator<blDataIteratorType,blNumberType>::moveIterator(s
 
 
 //-------------------------------------------------------------------
-// Function used to calculate the total number of rows
-// in the provided csv data as well as the number of
-// columns per row
+// Function used to move the iterator to the specified
+// data point using the row index and/or the data point
+// checkpoints
 //-------------------------------------------------------------------
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline void blCSVMatrixIterator<blDataIteratorType,blNumberType>::calculateTotalNumberOfRowsAndColumns()
+inline void blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::moveIteratorUsingIndexes(const std::ptrdiff_t& newDataIndex)
 {
-    // Here we attempt to find the
-    // first non-empty data row
-
-    auto titleRowBeginIter = m_endIter;
-    auto titleRowEndIter = m_endIter;
+    if(newDataIndex < 0)
+    {
+        moveToTheBeginning();
+        return;
+    }
+    else if(newDataIndex >= static_cast<std::ptrdiff_t>(m_layout->m_size))
+    {
+        moveToTheEnd();
+        return;
+    }
 
-    auto rowBeginIter = m_beginIter;
-    auto rowEndIter = m_beginIter;
 
-    int rowIndex = blAlgorithmsLIB::findBeginAndEndOfNthDataPoint(m_beginIter,
-                                                                  m_endIter,
-                                                                  m_rowTokens.begin(),
-                                                                  m_rowTokens.end(),
-                                                                  false,
-                                                                  0,
-                                                                  rowBeginIter,
-                                                                  rowEndIter);
 
+    // The scan counts every field of the
+    // csv data, so we work with indexes
+    // counted in the csv data, which are
+    // different from the iterator's own
+    // indexes when columns are projected
 
+    std::ptrdiff_t newRowIndex = newDataIndex / m_layout->m_cols;
+    std::ptrdiff_t newColIndex = newDataIndex % m_layout->m_cols;
 
-    // If we could not find a non-empty row
-    // we set everything to zero and quit
+    std::ptrdiff_t newDataIndexInData = getDataIndexInData(newRowIndex,newColIndex);
 
-    if(rowIndex < 0)
-    {
-        m_rows = 0;
-        m_cols = 0;
-        m_size = 0;
-        m_rowIndex = 0;
-        m_colIndex = 0;
-        m_dataIndex = 0;
-        m_columnNames.clear();
-        m_iter = m_endIter;
 
-        return;
-    }
 
+    // We look for the closest known
+    // position before the requested
+    // data point, starting with the
+    // first data point itself
 
+    auto startingIter = m_firstDataPointIter;
+    std::ptrdiff_t startingDataIndex = 0;
 
-    // Since we successfully found the first
-    // non-empty row, we now check to see
-    // if that row contains non-numeric
-    // characters, meaning it is the title
-    // row
 
-    std::string purelyNumericalRowTokens = s_digits;
-    purelyNumericalRowTokens += m_colTokens;
 
-    auto firstNonNumericalIter = blAlgorithmsLIB::find_first_not_of(rowBeginIter,
-                                                                    rowEndIter,
-                                                                    purelyNumericalRowTokens.begin(),
-                                                                    purelyNumericalRowTokens.end(),
-                                                                    0);
+    // The current position is a valid
+    // starting point if we are moving
+    // forward
 
-    if(firstNonNumericalIter == rowEndIter)
+    if(m_iter != m_endIter)
     {
-        // This means that this csv has
-        // no title row, so we set the
-        // first data point iter to be
-        // the beginning of the first
-        // non-empty row
+        std::ptrdiff_t currentDataIndexInData = getDataIndexInData(m_rowIndex,m_colIndex);
 
-        m_firstDataPointIter = rowBeginIter;
-    }
-    else
-    {
-        // This means that this csv does
-        // have a title row, so we set the
-        // first data point iter to be the
-        // beginning of the next (second)
-        // non-empty row
-
-        titleRowBeginIter = rowBeginIter;
-        titleRowEndIter = rowEndIter;
-
-        rowIndex = blAlgorithmsLIB::findBeginAndEndOfNthDataPoint(titleRowBeginIter,
-                                                                  m_endIter,
-                                                                  m_rowTokens.begin(),
-                                                                  m_rowTokens.end(),
-                                                                  false,
-                                                                  1,
-                                                                  rowBeginIter,
-                                                                  rowEndIter);
-
-        if(rowIndex == 1)
-            m_firstDataPointIter = rowBeginIter;
-        else
+        if(currentDataIndexInData <= newDataIndexInData)
         {
-            // This means we could not find
-            // any data rows, so we set
-            // everything to zero and quit
-
-            m_rows = 0;
-            m_cols = 0;
-            m_size = 0;
-            m_rowIndex = 0;
-            m_colIndex = 0;
-            m_dataIndex = 0;
-            m_columnNames.clear();
-            m_iter = m_endIter;
-
-            return;
+            startingIter = m_iter;
+            startingDataIndex = currentDataIndexInData;
         }
     }
 
 
 
-    // We assume the csv is properly formatted
-    // to represent a matrix and therefore
-    // only use the first row to count how many
-    // columns there are per each row
-
-    // NOTE:  We DO NOT count empty columns where in the
-    //        provided csv we have two or more following
-    //        column tokens (for ex. "3,,4,4,5" would be
-    //        4 columns and not 5
-
-    m_rows = blAlgorithmsLIB::countDataRows(rowBeginIter,
-                                            m_endIter,
-                                            m_rowTokens.begin(),
-                                            m_rowTokens.end(),
-                                            false);
+    // The beginning of the requested
+    // data point's row
 
+    if(isRowIndexBuilt())
+    {
+        std::ptrdiff_t rowBeginDataIndex = newRowIndex * m_layout->m_colsInData;
 
+        if(rowBeginDataIndex > startingDataIndex)
+        {
+            startingIter = m_beginIter;
+            std::advance(startingIter,m_layout->m_rowOffsets[newRowIndex]);
+            startingDataIndex = rowBeginDataIndex;
+        }
+    }
 
-    // We then use the first data row
-    // to count the number of data columns
 
-    m_cols = blAlgorithmsLIB::countDataRows(rowBeginIter,
-                                            rowEndIter,
-                                            m_colTokens.begin(),
-                                            m_colTokens.end(),
-                                            false);
 
+    // The closest data point
+    // checkpoint
 
+    if(areDataPointCheckpointsBuilt())
+    {
+        std::ptrdiff_t checkpointIndex = std::min(newDataIndexInData / m_layout->m_dataPointCheckpointInterval,
+                                                  static_cast<std::ptrdiff_t>(m_layout->m_dataPointCheckpointOffsets.size()) - 1);
 
-    m_size = m_cols * m_rows;
+        std::ptrdiff_t checkpointDataIndex = checkpointIndex * m_layout->m_dataPointCheckpointInterval;
 
+        if(checkpointDataIndex > startingDataIndex)
+        {
+            startingIter = m_beginIter;
+            std::advance(startingIter,m_layout->m_dataPointCheckpointOffsets[checkpointIndex]);
+            startingDataIndex = checkpointDataIndex;
+        }
+    }
 
 
-    // We try to get the names
-    // of each column by parsing
-    // the title row if we found
-    // one
 
-    m_columnNames.clear();
+    // We then scan only from the
+    // starting position to the
+    // requested data point
 
-    std::ptrdiff_t numberOfColumnNames = blAlgorithmsLIB::countDataRows(titleRowBeginIter,
-                                                                        titleRowEndIter,
-                                                                        m_colTokens.begin(),
-                                                                        m_colTokens.end(),
-                                                                        false);
+    std::ptrdiff_t movement = newDataIndexInData - startingDataIndex;
 
-    auto columnNameBeginIter = titleRowBeginIter;
-    auto columnNameEndIter = titleRowBeginIter;
+    std::ptrdiff_t actualMovement = findBeginningOfNthField(startingIter,
+                                                            m_endIter,
+                                                            m_layout->m_rowAndColTokenScanner,
+                                                            movement,
+                                                            m_iter);
 
-    for(int i = 0; i < numberOfColumnNames && i < m_cols; ++i)
+    if(actualMovement < movement)
     {
-        blAlgorithmsLIB::findBeginAndEndOfNthDataPoint(titleRowBeginIter,
-                                                       titleRowEndIter,
-                                                       m_rowAndColTokensCombined.begin(),
-                                                       m_rowAndColTokensCombined.end(),
-                                                       false,
-                                                       i,
-                                                       columnNameBeginIter,
-                                                       columnNameEndIter);
-
-        m_columnNames.push_back(std::string(columnNameBeginIter,columnNameEndIter));
+        moveToTheEnd();
+        return;
     }
+
+    m_dataIndex = newDataIndex;
+    m_rowIndex = newRowIndex;
+    m_colIndex = newColIndex;
+
+    convertToNumberFromCurrentPosition();
 }
 //-------------------------------------------------------------------
 
 
 
 //-------------------------------------------------------------------
-// Functions used to get the class' members
+// Function used to make sure that the layout is not
+// shared before changing it (copy-on-write)
 //-------------------------------------------------------------------
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline const blDataIteratorType& blCSVMatrixIterator<blDataIteratorType,blNumberType>::getBeginIter()const
+inline void blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::makeLayoutUnique()
 {
-    return m_beginIter;
+    if(m_layout.use_count() > 1)
+        m_layout = std::make_shared<blCSVMatrixLayout>(*m_layout);
 }
+//-------------------------------------------------------------------
 
 
 
+//-------------------------------------------------------------------
+// Function used to apply the column projection to the
+// layout (the layout must not be shared)
+//-------------------------------------------------------------------
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline const blDataIteratorType& blCSVMatrixIterator<blDataIteratorType,blNumberType>::getEndIter()const
+inline void blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::applyColumnProjection()
 {
-    return m_endIter;
-}
-
+    // We ignore the columns that
+    // are not in the csv data and
+    // the repeated ones
 
+    auto& projectedColIndexes = m_layout->m_projectedColIndexes;
+    std::ptrdiff_t colsInData = m_layout->m_colsInData;
 
-template<typename blDataIteratorType,
-         typename blNumberType>
+    std::vector<bool> isColumnAlreadyProjected(std::max(colsInData,std::ptrdiff_t(0)),false);
 
-inline const blDataIteratorType& blCSVMatrixIterator<blDataIteratorType,blNumberType>::getIter()const
-{
-    return m_iter;
-}
+    auto shouldColumnBeIgnored = [colsInData,&isColumnAlreadyProjected](const std::ptrdiff_t& colIndex)
+    {
+        if(colIndex < 0 || colIndex >= colsInData || isColumnAlreadyProjected[colIndex])
+            return true;
 
+        isColumnAlreadyProjected[colIndex] = true;
+        return false;
+    };
 
+    projectedColIndexes.erase(std::remove_if(projectedColIndexes.begin(),
+                                             projectedColIndexes.end(),
+                                             shouldColumnBeIgnored),
+                              projectedColIndexes.end());
 
-template<typename blDataIteratorType,
-         typename blNumberType>
 
-inline const blDataIteratorType& blCSVMatrixIterator<blDataIteratorType,blNumberType>::getFirstDataPointIter()const
-{
-    return m_firstDataPointIter;
-}
 
+    m_layout->m_columnNames.clear();
 
+    if(projectedColIndexes.empty())
+    {
+        m_layout->m_cols = colsInData;
+        m_layout->m_columnNames = m_layout->m_columnNamesInData;
+    }
+    else
+    {
+        m_layout->m_cols = static_cast<std::ptrdiff_t>(projectedColIndexes.size());
 
-template<typename blDataIteratorType,
-         typename blNumberType>
+        if(!m_layout->m_columnNamesInData.empty())
+        {
+            for(const auto& colIndex : projectedColIndexes)
+            {
+                if(colIndex < static_cast<std::ptrdiff_t>(m_layout->m_columnNamesInData.size()))
+                    m_layout->m_columnNames.push_back(m_layout->m_columnNamesInData[colIndex]);
+                else
+                    m_layout->m_columnNames.push_back(std::string());
+            }
+        }
+    }
 
-inline const blNumberType& blCSVMatrixIterator<blDataIteratorType,blNumberType>::getNumber()const
-{
-    return m_number;
+    m_layout->m_size = m_layout->m_cols * m_layout->m_rows;
 }
+//-------------------------------------------------------------------
 
 
 
+//-------------------------------------------------------------------
+// Functions used to get the index (counted in the csv
+// data) of a projected column or data point
+//-------------------------------------------------------------------
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline const std::ptrdiff_t& blCSVMatrixIterator<blDataIteratorType,blNumberType>::rows()const
+inline std::ptrdiff_t blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::getColIndexInData(const std::ptrdiff_t& colIndex)const
 {
-    return m_rows;
-}
-
-
-
-template<typename blDataIteratorType,
-         typename blNumberType>
+    if(m_layout->m_projectedColIndexes.empty())
+        return colIndex;
 
-inline const std::ptrdiff_t& blCSVMatrixIterator<blDataIteratorType,blNumberType>::cols()const
-{
-    return m_cols;
+    return m_layout->m_projectedColIndexes[colIndex];
 }
 
 
 
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline const std::size_t& blCSVMatrixIterator<blDataIteratorType,blNumberType>::size()const
+inline std::ptrdiff_t blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::getDataIndexInData(const std::ptrdiff_t& rowIndex,
+                                                                                                const std::ptrdiff_t& colIndex)const
 {
-    return m_size;
+    return rowIndex * m_layout->m_colsInData + getColIndexInData(colIndex);
 }
+//-------------------------------------------------------------------
 
 
 
+//-------------------------------------------------------------------
+// Function used to point the iterator to the first
+// data point (the first projected column of the
+// first data row)
+//-------------------------------------------------------------------
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline const std::size_t& blCSVMatrixIterator<blDataIteratorType,blNumberType>::length()const
+inline void blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::pointToTheFirstDataPoint()
 {
-    return m_size;
-}
+    m_rowIndex = 0;
+    m_colIndex = 0;
+    m_dataIndex = 0;
 
+    if(m_layout->m_size == 0)
+    {
+        m_iter = m_endIter;
+        return;
+    }
 
+    if(areRowFieldCountsBuilt())
+    {
+        m_iter = m_endIter;
+        pointToDataPointInRaggedRows(0,0);
+        return;
+    }
 
-template<typename blDataIteratorType,
-         typename blNumberType>
+    m_iter = m_firstDataPointIter;
 
-inline const std::ptrdiff_t& blCSVMatrixIterator<blDataIteratorType,blNumberType>::rowIndex()const
-{
-    return m_rowIndex;
+    if(isColumnProjected())
+    {
+        findBeginningOfNthField(m_firstDataPointIter,
+                                m_endIter,
+                                m_layout->m_rowAndColTokenScanner,
+                                getColIndexInData(0),
+                                m_iter);
+    }
 }
+//-------------------------------------------------------------------
 
 
 
+//-------------------------------------------------------------------
+// Function used to point the iterator to the specified
+// row and column in the ragged rows mode
+//-------------------------------------------------------------------
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline const std::ptrdiff_t& blCSVMatrixIterator<blDataIteratorType,blNumberType>::colIndex()const
+inline void blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::pointToDataPointInRaggedRows(const std::ptrdiff_t& newRowIndex,
+                                                                                                                     const std::ptrdiff_t& newColIndex)
 {
-    return m_colIndex;
-}
-
+    std::ptrdiff_t newColIndexInData = getColIndexInData(newColIndex);
 
+    auto rowBeginIter = m_beginIter;
+    std::advance(rowBeginIter,m_layout->m_rowOffsets[newRowIndex]);
 
-template<typename blDataIteratorType,
-         typename blNumberType>
 
-inline const std::string& blCSVMatrixIterator<blDataIteratorType,blNumberType>::rowTokens()const
-{
-    return m_rowTokens;
-}
 
+    if(newColIndexInData >= m_layout->m_rowFieldCounts[newRowIndex])
+    {
+        m_iter = rowBeginIter;
+    }
+    else
+    {
+        // We continue the scan from the
+        // current data point if it is in
+        // the same row and before the
+        // requested one
 
+        auto startingIter = rowBeginIter;
+        std::ptrdiff_t startingColIndexInData = 0;
 
-template<typename blDataIteratorType,
-         typename blNumberType>
+        if(m_iter != m_endIter &&
+           m_rowIndex == newRowIndex &&
+           !isCurrentDataPointMissing())
+        {
+            std::ptrdiff_t currentColIndexInData = getColIndexInData(m_colIndex);
 
-inline const std::string& blCSVMatrixIterator<blDataIteratorType,blNumberType>::colTokens()const
-{
-    return m_colTokens;
-}
+            if(currentColIndexInData <= newColIndexInData)
+            {
+                startingIter = m_iter;
+                startingColIndexInData = currentColIndexInData;
+            }
+        }
 
+        findBeginningOfNthField(startingIter,
+                                m_endIter,
+                                m_layout->m_rowAndColTokenScanner,
+                                newColIndexInData - startingColIndexInData,
+                                m_iter);
+    }
 
 
-template<typename blDataIteratorType,
-         typename blNumberType>
 
-inline const std::vector<std::string>& blCSVMatrixIterator<blDataIteratorType,blNumberType>::getColumnNames()const
-{
-    return m_columnNames;
+    m_rowIndex = newRowIndex;
+    m_colIndex = newColIndex;
+    m_dataIndex = newRowIndex * m_layout->m_cols + newColIndex;
 }
 //-------------------------------------------------------------------
 
 
 
 //-------------------------------------------------------------------
-// Functions used to set/get the advancing iterator method
+// Function used to build the row cursors used when
+// advancing the iterator in a column-major way
 //-------------------------------------------------------------------
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline const blAdvancingIteratorMethod& blCSVMatrixIterator<blDataIteratorType,blNumberType>::getAdvancingIteratorMethod()const
+inline void blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::buildRowCursors()
 {
-    return m_advancingIteratorMethod;
-}
-
-
+    // Every cursor starts at the
+    // beginning of its row, which
+    // we get from the row index if
+    // we have one or by finding the
+    // rows otherwise
+    m_rowCursors.reset(new blCSVRowCursors());
+
+    if(isRowIndexBuilt())
+    {
+        m_rowCursors->m_offsets = m_layout->m_rowOffsets;
+    }
+    else
+    {
+        findOffsetsOfAllFields(m_firstDataPointIter,
+                               m_endIter,
+                               m_layout->m_rowTokens,
+                               m_rowCursors->m_offsets);
+    }
 
-template<typename blDataIteratorType,
-         typename blNumberType>
+    m_rowCursors->m_offsets.resize(m_layout->m_rows,std::distance(m_beginIter,m_endIter));
 
-inline void blCSVMatrixIterator<blDataIteratorType,blNumberType>::setAdvancingIteratorMethod(const blAdvancingIteratorMethod& advancingIteratorMethod)
-{
-    m_advancingIteratorMethod = advancingIteratorMethod;
+    m_rowCursors->m_colIndexes.assign(m_layout->m_rows,0);
 }
 //-------------------------------------------------------------------
 
 
 
 //-------------------------------------------------------------------
-// Functions used to move the current iterator position
-// to the beginning or to the end
+// Function used to move the iterator to the specified
+// row and column by continuing the scan from the last
+// visited data point of that row
 //-------------------------------------------------------------------
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline blCSVMatrixIterator<blDataIteratorType,blNumberType>& blCSVMatrixIterator<blDataIteratorType,blNumberType>::moveToTheBeginning()
+inline void blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::moveIteratorUsingRowCursors(const std::ptrdiff_t& newRowIndex,
+                                                                                                                    const std::ptrdiff_t& newColIndex)
 {
-    // We set everything back to the beginning
-    // of the supplied csv data stream
-
-    // If the supplied csv data size is zero
-    // then we set everything to the end
-
-    if(m_size == 0)
-        m_iter = m_endIter;
-    else
-        m_iter = m_firstDataPointIter;
-
-    m_dataIndex = 0;
-    m_rowIndex = 0;
-    m_colIndex = 0;
+    // The cursors are only worth building
+    // (which costs a pass over the rows) once
+    // the iterator keeps moving in a column-major
+    // way, so the first move is done without them
 
-    return (*this);
-}
+    if(!m_rowCursors ||
+       static_cast<std::ptrdiff_t>(m_rowCursors->m_offsets.size()) != m_layout->m_rows)
+    {
+        if(m_hasMovedInColumnMajorWay)
+            buildRowCursors();
+        else
+            m_rowCursors.reset();
 
+        m_hasMovedInColumnMajorWay = true;
+    }
 
 
-template<typename blDataIteratorType,
-         typename blNumberType>
 
-inline blCSVMatrixIterator<blDataIteratorType,blNumberType>& blCSVMatrixIterator<blDataIteratorType,blNumberType>::moveToTheEnd()
-{
-    // We set everything to point to the end
-    // of the supplied binary data stream
+    // The cursors count the columns
+    // of the csv data, which differ
+    // from the iterator's columns
+    // when columns are projected
 
-    m_iter = m_endIter;
+    std::ptrdiff_t newColIndexInData = getColIndexInData(newColIndex);
 
-    m_dataIndex = m_size;
-    m_rowIndex = m_rows;
-    m_colIndex = m_cols;
 
-    return (*this);
-}
-//-------------------------------------------------------------------
 
+    // We start the scan from the row's
+    // cursor, unless we have none or it's
+    // already past the requested column,
+    // in which case we restart from the
+    // beginning of the row, which we can
+    // only find quickly if we have a row
+    // index, otherwise we just move the
+    // iterator in a row-major way and
+    // update the cursor with the result
 
+    std::ptrdiff_t cursorOffset = 0;
+    std::ptrdiff_t cursorColIndexInData = 0;
 
+    if(m_rowCursors && m_rowCursors->m_colIndexes[newRowIndex] <= newColIndexInData)
+    {
+        cursorOffset = m_rowCursors->m_offsets[newRowIndex];
+        cursorColIndexInData = m_rowCursors->m_colIndexes[newRowIndex];
+    }
+    else if(isRowIndexBuilt())
+    {
+        cursorOffset = m_layout->m_rowOffsets[newRowIndex];
+    }
+    else
+    {
+        moveIterator((newRowIndex * m_layout->m_cols + newColIndex) - m_dataIndex,ROW_MAJOR);
+
+        if(m_rowCursors && m_iter != m_endIter)
+        {
+            m_rowCursors->m_offsets[newRowIndex] = std::distance(m_beginIter,m_iter);
+            m_rowCursors->m_colIndexes[newRowIndex] = newColIndexInData;
+        }
+
+        return;
+    }
+
+
+
+    // We scan forward from the cursor
+    // only as many data points as needed
+
+    auto cursorIter = m_beginIter;
+    std::advance(cursorIter,cursorOffset);
+
+    std::ptrdiff_t movement = newColIndexInData - cursorColIndexInData;
+
+    std::ptrdiff_t actualMovement = findBeginningOfNthField(cursorIter,
+                                                            m_endIter,
+                                                            m_layout->m_rowAndColTokenScanner,
+                                                            movement,
+                                                            m_iter);
+
+    if(actualMovement < movement)
+    {
+        moveToTheEnd();
+        return;
+    }
+
+    if(m_rowCursors)
+    {
+        m_rowCursors->m_offsets[newRowIndex] = std::distance(m_beginIter,m_iter);
+        m_rowCursors->m_colIndexes[newRowIndex] = newColIndexInData;
+    }
+
+    m_rowIndex = newRowIndex;
+    m_colIndex = newColIndex;
+    m_dataIndex = m_rowIndex * m_layout->m_cols + m_colIndex;
+
+    convertToNumberFromCurrentPosition();
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to calculate the total number of rows
+// in the provided csv data as well as the number of
+// columns per row
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline void blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::calculateTotalNumberOfRowsAndColumns()
+{
+    // The layout is about to change, so
+    // we make sure it's not shared
+
+    makeLayoutUnique();
+
+
+
+    // Any row cursors refer to the
+    // previous data so we discard them
+
+    m_rowCursors.reset();
+
+    m_layout->m_lastRowBeginOffset = -1;
+
+
+
+    // We don't know yet whether the csv
+    // data has any quotes, so we respect
+    // them while looking for the first
+    // data row, the scan of all the rows
+    // below then finds out (in the same
+    // pass), so that data without quotes
+    // can keep using the faster scans
+
+    m_layout->m_hasQuotedFields = true;
+
+
+
+    // Here we attempt to find the first
+    // non-empty data row, skipping the
+    // comment lines and the header rows
+    // before it, in the same pass
+    // Quotes don't make a row a title
+    // row, since numbers can be quoted
+
+    auto titleRowBeginIter = m_endIter;
+    auto titleRowEndIter = m_endIter;
+
+    auto searchBeginIter = m_beginIter;
+
+    auto rowBeginIter = m_beginIter;
+    auto rowEndIter = m_beginIter;
+
+    int rowIndex = -1;
+
+    std::ptrdiff_t numberOfHeaderRowsFound = 0;
+
+    blTokenSet purelyNumericalRowTokens(s_digits);
+    purelyNumericalRowTokens.addTokens(m_layout->m_colTokens.begin(),m_layout->m_colTokens.end());
+    purelyNumericalRowTokens.addToken(s_quoteToken);
+
+    while(true)
+    {
+        // We skip any empty rows
+
+        searchBeginIter = blAlgorithmsLIB::find_first_not_of(searchBeginIter,
+                                                             m_endIter,
+                                                             m_layout->m_rowTokens.begin(),
+                                                             m_layout->m_rowTokens.end(),
+                                                             0);
+
+        if(searchBeginIter == m_endIter)
+            break;
+
+
+
+        // Comment lines are not csv data,
+        // so we find their end without
+        // looking for quotes
+
+        if(isCommentRow(searchBeginIter))
+        {
+            searchBeginIter = blAlgorithmsLIB::find_first_of(searchBeginIter,
+                                                             m_endIter,
+                                                             m_layout->m_rowTokens.begin(),
+                                                             m_layout->m_rowTokens.end(),
+                                                             0);
+            continue;
+        }
+
+
+
+        rowIndex = findBeginAndEndOfNthField(searchBeginIter,
+                                             m_endIter,
+                                             m_layout->m_rowTokens,
+                                             0,
+                                             rowBeginIter,
+                                             rowEndIter);
+
+        if(rowIndex < 0)
+            break;
+
+
+
+        // When the number of header rows
+        // is not known, the first row is
+        // the title row if it contains
+        // non-numeric characters
+
+        bool isHeaderRow = false;
+
+        if(m_layout->m_numberOfHeaderRows < 0)
+        {
+            isHeaderRow = (numberOfHeaderRowsFound == 0 &&
+                           blAlgorithmsLIB::find_first_not_of(rowBeginIter,
+                                                              rowEndIter,
+                                                              purelyNumericalRowTokens,
+                                                              0) != rowEndIter);
+        }
+        else
+            isHeaderRow = (numberOfHeaderRowsFound < m_layout->m_numberOfHeaderRows);
+
+        if(!isHeaderRow)
+            break;
+
+
+
+        // The column names are taken
+        // from the first header row
+
+        if(numberOfHeaderRowsFound == 0)
+        {
+            titleRowBeginIter = rowBeginIter;
+            titleRowEndIter = rowEndIter;
+        }
+
+        ++numberOfHeaderRowsFound;
+
+        rowIndex = -1;
+        searchBeginIter = rowEndIter;
+    }
+
+
+
+    // If we could not find a data row
+    // we set everything to zero and quit
+
+    if(rowIndex < 0)
+    {
+        m_layout->m_rows = 0;
+        m_layout->m_cols = 0;
+        m_layout->m_colsInData = 0;
+        m_layout->m_size = 0;
+        m_rowIndex = 0;
+        m_colIndex = 0;
+        m_dataIndex = 0;
+        m_layout->m_columnNames.clear();
+        m_layout->m_columnNamesInData.clear();
+        m_layout->m_rowOffsets.clear();
+        m_layout->m_rowFieldCounts.clear();
+        m_layout->m_dataPointCheckpointOffsets.clear();
+        m_iter = m_endIter;
+
+        return;
+    }
+
+    m_firstDataPointIter = rowBeginIter;
+
+
+
+    // We assume the csv is properly formatted
+    // to represent a matrix and therefore
+    // only use the first row to count how many
+    // columns there are per each row
+
+    // NOTE:  We DO NOT count empty columns where in the
+    //        provided csv we have two or more following
+    //        column tokens (for ex. "3,,4,4,5" would be
+    //        4 columns and not 5
+
+    // If the user wants a row index, we
+    // record the offset of each row while
+    // counting them (in the same pass)
+
+    // In the ragged rows mode the same
+    // pass also records the number of
+    // fields of every data row
+
+    // The scan respects quotes, which
+    // finds the same rows when there are
+    // none, and tells us whether there
+    // are any, the rows before the first
+    // data row were already looked at
+
+    m_layout->m_rowOffsets.clear();
+    m_layout->m_rowFieldCounts.clear();
+
+    bool hasQuoteBeenFound = false;
+
+    m_layout->m_rows = scanDataRowsRespectingQuotes(rowBeginIter,
+                                                    m_endIter,
+                                                    m_layout->m_rowTokenScanner,
+                                                    m_layout->m_colTokenScanner,
+                                                    m_layout->m_quoteTokenScanner,
+                                                    std::distance(m_beginIter,rowBeginIter),
+                                                    m_layout->m_shouldRowIndexBeBuilt ? &m_layout->m_rowOffsets : nullptr,
+                                                    m_layout->m_shouldRaggedRowsBeHandled ? &m_layout->m_rowFieldCounts : nullptr,
+                                                    hasQuoteBeenFound);
+
+    m_layout->m_hasQuotedFields = (hasQuoteBeenFound ||
+                                   std::find(m_beginIter,rowBeginIter,s_quoteToken) != rowBeginIter);
+
+    if(!m_layout->m_rowOffsets.empty())
+        m_layout->m_lastRowBeginOffset = m_layout->m_rowOffsets.back();
+
+
+
+    // We then use the first data row
+    // to count the number of data columns
+
+    m_layout->m_colsInData = countFields(rowBeginIter,
+                                         rowEndIter,
+                                         m_layout->m_colTokenScanner);
+
+
+
+    // In the ragged rows mode the number
+    // of data columns is the one of the
+    // longest row instead
+
+    if(!m_layout->m_rowFieldCounts.empty())
+    {
+        m_layout->m_colsInData = *std::max_element(m_layout->m_rowFieldCounts.begin(),
+                                                   m_layout->m_rowFieldCounts.end());
+    }
+
+
+
+    // If the user wants data point
+    // checkpoints, we record the offset
+    // of every Kth data point
+
+    m_layout->m_dataPointCheckpointOffsets.clear();
+
+    if(m_layout->m_dataPointCheckpointInterval > 0)
+    {
+        findOffsetsOfEveryNthField(m_firstDataPointIter,
+                                   m_endIter,
+                                   m_layout->m_rowAndColTokensCombined,
+                                   m_layout->m_dataPointCheckpointInterval,
+                                   m_layout->m_dataPointCheckpointOffsets);
+    }
+
+
+
+    // We try to get the names
+    // of each column by parsing
+    // the title row if we found
+    // one
+
+    m_layout->m_columnNames.clear();
+    m_layout->m_columnNamesInData.clear();
+
+    std::ptrdiff_t numberOfColumnNames = countFields(titleRowBeginIter,
+                                                     titleRowEndIter,
+                                                     m_layout->m_colTokenScanner);
+
+    auto columnNameBeginIter = titleRowBeginIter;
+    auto columnNameEndIter = titleRowBeginIter;
+
+    for(int i = 0; i < numberOfColumnNames && i < m_layout->m_colsInData; ++i)
+    {
+        findBeginAndEndOfNthField(titleRowBeginIter,
+                                  titleRowEndIter,
+                                  m_layout->m_rowAndColTokensCombined,
+                                  i,
+                                  columnNameBeginIter,
+                                  columnNameEndIter);
+
+        if(m_layout->m_hasQuotedFields && (*columnNameBeginIter) == s_quoteToken)
+        {
+            std::string columnName;
+            copyQuotedField(columnNameBeginIter,columnNameEndIter,columnName);
+            m_layout->m_columnNamesInData.push_back(columnName);
+        }
+        else
+            m_layout->m_columnNamesInData.push_back(std::string(columnNameBeginIter,columnNameEndIter));
+    }
+
+
+
+    // We apply the column projection
+    // (if any) to get the columns and
+    // the size exposed by the iterator
+
+    applyColumnProjection();
+
+
+
+    // Finally we point the iterator
+    // to the first data point
+
+    pointToTheFirstDataPoint();
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to know whether a row begins
+// with one of the comment prefixes
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline bool blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::isCommentRow(const blDataIteratorType& rowBeginIter)const
+{
+    for(const auto& commentPrefix : m_layout->m_commentPrefixes)
+    {
+        if(commentPrefix.empty())
+            continue;
+
+        auto currentIter = rowBeginIter;
+        auto prefixIter = commentPrefix.begin();
+
+        while(prefixIter != commentPrefix.end() &&
+              currentIter != m_endIter &&
+              (*currentIter) == (*prefixIter))
+        {
+            ++currentIter;
+            ++prefixIter;
+        }
+
+        if(prefixIter == commentPrefix.end())
+            return true;
+    }
+
+    return false;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used to follow csv data that is
+// still being appended to
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline void blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::appendData(const blDataIteratorType& newEndIter)
+{
+    appendData(m_beginIter,
+               newEndIter);
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline void blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::appendData(const blDataIteratorType& newBeginIter,
+                                                                                                   const blDataIteratorType& newEndIter)
+{
+    // Everything we know about the csv
+    // data is stored as offsets from the
+    // begin iterator, so we remember the
+    // old positions as offsets
+
+    std::ptrdiff_t firstDataPointOffset = std::distance(m_beginIter,m_firstDataPointIter);
+    std::ptrdiff_t currentOffset = std::distance(m_beginIter,m_iter);
+
+    bool wasIteratorAtTheEnd = (m_iter == m_endIter);
+
+
+
+    // If we don't have at least one full
+    // data row before the last one, then
+    // the title row or the number of
+    // columns might still change, so we
+    // just rescan everything (the data
+    // is small anyway)
+
+    if(m_layout->m_rows < 2)
+    {
+        setIterators(newBeginIter,
+                     newEndIter,
+                     m_layout->m_rowTokens,
+                     m_layout->m_colTokens);
+
+        return;
+    }
+
+
+
+    // The layout is about to change, so
+    // we make sure it's not shared
+
+    makeLayoutUnique();
+
+
+
+    // If we don't know where the last
+    // row begins (because we did not
+    // build a row index), we have to
+    // find it once
+
+    if(m_layout->m_lastRowBeginOffset < 0)
+    {
+        auto lastRowBeginIter = m_endIter;
+
+        std::ptrdiff_t lastRowIndex = findBeginningOfNthField(m_firstDataPointIter,
+                                                              m_endIter,
+                                                              m_layout->m_rowTokenScanner,
+                                                              m_layout->m_rows - 1,
+                                                              lastRowBeginIter);
+
+        if(lastRowIndex != m_layout->m_rows - 1)
+        {
+            setIterators(newBeginIter,
+                         newEndIter,
+                         m_layout->m_rowTokens,
+                         m_layout->m_colTokens);
+
+            return;
+        }
+
+        m_layout->m_lastRowBeginOffset = std::distance(m_beginIter,lastRowBeginIter);
+    }
+
+
+
+    // We point to the new data
+
+    m_beginIter = newBeginIter;
+    m_endIter = newEndIter;
+
+    m_firstDataPointIter = m_beginIter;
+    std::advance(m_firstDataPointIter,firstDataPointOffset);
+
+    auto lastRowBeginIter = m_beginIter;
+    std::advance(lastRowBeginIter,m_layout->m_lastRowBeginOffset);
+
+
+
+    // The last row might have been partial,
+    // so we forget it and scan again from
+    // its beginning to the new end
+    // The same scan tells us whether the
+    // appended data is the first one to
+    // contain quotes, since a row always
+    // begins outside of quotes, the rows
+    // we already found are still valid
+
+    std::ptrdiff_t numberOfCompleteRows = m_layout->m_rows - 1;
+
+    std::vector<std::ptrdiff_t> appendedRowOffsets;
+    std::vector<std::ptrdiff_t> appendedRowFieldCounts;
+
+    bool hasQuoteBeenFound = false;
+
+    std::ptrdiff_t numberOfAppendedRows = scanDataRowsRespectingQuotes(lastRowBeginIter,
+                                                                       m_endIter,
+                                                                       m_layout->m_rowTokenScanner,
+                                                                       m_layout->m_colTokenScanner,
+                                                                       m_layout->m_quoteTokenScanner,
+                                                                       m_layout->m_lastRowBeginOffset,
+                                                                       &appendedRowOffsets,
+                                                                       m_layout->m_shouldRaggedRowsBeHandled ? &appendedRowFieldCounts : nullptr,
+                                                                       hasQuoteBeenFound);
+
+    if(hasQuoteBeenFound)
+        m_layout->m_hasQuotedFields = true;
+
+    m_layout->m_rows = numberOfCompleteRows + numberOfAppendedRows;
+    m_layout->m_size = m_layout->m_cols * m_layout->m_rows;
+
+    if(!appendedRowOffsets.empty())
+        m_layout->m_lastRowBeginOffset = appendedRowOffsets.back();
+
+
+
+    // We update the row index
+
+    if(m_layout->m_shouldRowIndexBeBuilt &&
+       static_cast<std::ptrdiff_t>(m_layout->m_rowOffsets.size()) == numberOfCompleteRows + 1)
+    {
+        m_layout->m_rowOffsets.resize(numberOfCompleteRows);
+        m_layout->m_rowOffsets.insert(m_layout->m_rowOffsets.end(),appendedRowOffsets.begin(),appendedRowOffsets.end());
+    }
+
+
+
+    // In the ragged rows mode the scan
+    // above counted the fields of the
+    // appended rows, if one of them is
+    // longer than all the others the
+    // number of columns changes, so we
+    // rescan everything
+
+    if(m_layout->m_shouldRaggedRowsBeHandled)
+    {
+        if(isRowIndexBuilt())
+        {
+            m_layout->m_rowFieldCounts.resize(numberOfCompleteRows);
+
+            m_layout->m_rowFieldCounts.insert(m_layout->m_rowFieldCounts.end(),appendedRowFieldCounts.begin(),appendedRowFieldCounts.end());
+        }
+
+        if(!areRowFieldCountsBuilt() ||
+           *std::max_element(m_layout->m_rowFieldCounts.begin(),m_layout->m_rowFieldCounts.end()) > m_layout->m_colsInData)
+        {
+            setIterators(m_beginIter,
+                         m_endIter,
+                         m_layout->m_rowTokens,
+                         m_layout->m_colTokens);
+
+            return;
+        }
+    }
+
+
+
+    // We update the row cursors (if
+    // they were already built), the
+    // cursors of the complete rows
+    // are still valid
+
+    if(m_rowCursors &&
+       static_cast<std::ptrdiff_t>(m_rowCursors->m_offsets.size()) == numberOfCompleteRows + 1)
+    {
+        m_rowCursors->m_offsets.resize(numberOfCompleteRows);
+        m_rowCursors->m_offsets.insert(m_rowCursors->m_offsets.end(),appendedRowOffsets.begin(),appendedRowOffsets.end());
+
+        m_rowCursors->m_colIndexes.resize(m_layout->m_rows,0);
+        m_rowCursors->m_colIndexes[numberOfCompleteRows] = 0;
+    }
+    else
+    {
+        m_rowCursors.reset();
+    }
+
+
+
+    // We update the data point checkpoints
+    // by scanning again from the last one,
+    // which could have been recorded in
+    // the partial last row
+
+    if(areDataPointCheckpointsBuilt())
+    {
+        auto lastCheckpointIter = m_beginIter;
+        std::advance(lastCheckpointIter,m_layout->m_dataPointCheckpointOffsets.back());
+
+        m_layout->m_dataPointCheckpointOffsets.pop_back();
+
+        findOffsetsOfEveryNthField(lastCheckpointIter,
+                                   m_endIter,
+                                   m_layout->m_rowAndColTokensCombined,
+                                   m_layout->m_dataPointCheckpointInterval,
+                                   m_layout->m_dataPointCheckpointOffsets);
+    }
+
+
+
+    // Finally we keep the iterator where
+    // it was, unless it was at the end,
+    // in which case it stays at the end
+    // The current data point is converted
+    // again since it might have been in
+    // the partial last row
+
+    if(wasIteratorAtTheEnd)
+    {
+        moveToTheEnd();
+    }
+    else
+    {
+        m_iter = m_beginIter;
+        std::advance(m_iter,currentOffset);
+
+        convertToNumberFromCurrentPosition();
+    }
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used to save/load the layout of the csv
+// data to/from an index
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline bool blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::saveIndex(std::ostream& outputStream)const
+{
+    std::ptrdiff_t dataLength = std::distance(m_beginIter,m_endIter);
+
+    std::vector<std::int64_t> rowOffsets(m_layout->m_rowOffsets.begin(),m_layout->m_rowOffsets.end());
+    std::vector<std::int64_t> dataPointCheckpointOffsets(m_layout->m_dataPointCheckpointOffsets.begin(),m_layout->m_dataPointCheckpointOffsets.end());
+    std::vector<std::int64_t> rowFieldCounts(m_layout->m_rowFieldCounts.begin(),m_layout->m_rowFieldCounts.end());
+
+    writeValue(outputStream,s_indexTag);
+    writeValue(outputStream,s_indexVersion);
+    writeValue(outputStream,static_cast<std::uint64_t>(dataLength));
+    writeValue(outputStream,computeFullDataFingerprint(m_beginIter,m_endIter));
+
+    writeSizedBuffer(outputStream,m_layout->m_rowTokens);
+    writeSizedBuffer(outputStream,m_layout->m_colTokens);
+
+    writeValue(outputStream,static_cast<std::int64_t>(m_layout->m_hasQuotedFields));
+    writeValue(outputStream,static_cast<std::int64_t>(m_layout->m_rows));
+    writeValue(outputStream,static_cast<std::int64_t>(m_layout->m_colsInData));
+    writeValue(outputStream,static_cast<std::int64_t>(std::distance(m_beginIter,m_firstDataPointIter)));
+    writeValue(outputStream,static_cast<std::int64_t>(m_layout->m_lastRowBeginOffset));
+    writeValue(outputStream,static_cast<std::int64_t>(m_layout->m_dataPointCheckpointInterval));
+    writeValue(outputStream,static_cast<std::int64_t>(m_layout->m_shouldRaggedRowsBeHandled));
+    writeValue(outputStream,static_cast<std::int64_t>(m_layout->m_numberOfHeaderRows));
+
+    writeValue(outputStream,static_cast<std::uint64_t>(m_layout->m_commentPrefixes.size()));
+
+    for(const auto& commentPrefix : m_layout->m_commentPrefixes)
+        writeSizedBuffer(outputStream,commentPrefix);
+
+    writeValue(outputStream,static_cast<std::uint64_t>(m_layout->m_columnNamesInData.size()));
+
+    for(const auto& columnName : m_layout->m_columnNamesInData)
+        writeSizedBuffer(outputStream,columnName);
+
+    writeSizedBuffer(outputStream,rowOffsets);
+    writeSizedBuffer(outputStream,dataPointCheckpointOffsets);
+    writeSizedBuffer(outputStream,rowFieldCounts);
+
+    return static_cast<bool>(outputStream);
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline bool blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::saveIndex(const std::string& indexFilePath)const
+{
+    // We write to a temporary file
+    // and then rename it, so that the
+    // index file is never seen half
+    // written
+
+    std::string temporaryFilePath = indexFilePath + ".tmp";
+
+    {
+        std::ofstream indexFile(temporaryFilePath,std::ios::binary | std::ios::trunc);
+
+        if(!indexFile)
+            return false;
+
+        if(!saveIndex(indexFile))
+        {
+            indexFile.close();
+            std::remove(temporaryFilePath.c_str());
+            return false;
+        }
+    }
+
+    return replaceFileWithTemporaryFile(indexFilePath,temporaryFilePath);
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline bool blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::loadIndex(std::istream& inputStream)
+{
+    std::ptrdiff_t dataLength = std::distance(m_beginIter,m_endIter);
+
+
+
+    // We first check that the index
+    // was saved for this data
+
+    std::uint64_t indexTag = 0;
+    std::uint64_t indexVersion = 0;
+    std::uint64_t indexedDataLength = 0;
+    std::uint64_t indexedDataFingerprint = 0;
+
+    readValue(inputStream,indexTag);
+    readValue(inputStream,indexVersion);
+    readValue(inputStream,indexedDataLength);
+    readValue(inputStream,indexedDataFingerprint);
+
+    if(!inputStream ||
+       indexTag != s_indexTag ||
+       indexVersion != s_indexVersion ||
+       indexedDataLength != static_cast<std::uint64_t>(dataLength) ||
+       indexedDataFingerprint != computeFullDataFingerprint(m_beginIter,m_endIter))
+    {
+        return false;
+    }
+
+
+
+    // Then that it was saved
+    // for the same tokens
+
+    std::string rowTokens;
+    std::string colTokens;
+
+    readSizedBuffer(inputStream,rowTokens,indexedDataLength);
+    readSizedBuffer(inputStream,colTokens,indexedDataLength);
+
+    if(!inputStream ||
+       rowTokens != m_layout->m_rowTokens ||
+       colTokens != m_layout->m_colTokens)
+    {
+        return false;
+    }
+
+
+
+    // We read the rest of the layout
+
+    std::int64_t hasQuotedFields = 0;
+    std::int64_t rows = 0;
+    std::int64_t colsInData = 0;
+    std::int64_t firstDataPointOffset = 0;
+    std::int64_t lastRowBeginOffset = 0;
+    std::int64_t dataPointCheckpointInterval = 0;
+    std::int64_t shouldRaggedRowsBeHandled = 0;
+    std::int64_t numberOfHeaderRows = 0;
+    std::uint64_t numberOfCommentPrefixes = 0;
+    std::uint64_t numberOfColumnNames = 0;
+
+    readValue(inputStream,hasQuotedFields);
+    readValue(inputStream,rows);
+    readValue(inputStream,colsInData);
+    readValue(inputStream,firstDataPointOffset);
+    readValue(inputStream,lastRowBeginOffset);
+    readValue(inputStream,dataPointCheckpointInterval);
+    readValue(inputStream,shouldRaggedRowsBeHandled);
+    readValue(inputStream,numberOfHeaderRows);
+    readValue(inputStream,numberOfCommentPrefixes);
+
+    if(!inputStream || numberOfCommentPrefixes > indexedDataLength)
+        return false;
+
+    std::vector<std::string> commentPrefixes(static_cast<std::size_t>(numberOfCommentPrefixes));
+
+    for(auto& commentPrefix : commentPrefixes)
+        readSizedBuffer(inputStream,commentPrefix,indexedDataLength);
+
+    readValue(inputStream,numberOfColumnNames);
+
+    if(!inputStream || numberOfColumnNames > indexedDataLength)
+        return false;
+
+    std::vector<std::string> columnNamesInData(static_cast<std::size_t>(numberOfColumnNames));
+
+    for(auto& columnName : columnNamesInData)
+        readSizedBuffer(inputStream,columnName,indexedDataLength);
+
+    std::vector<std::int64_t> rowOffsets;
+    std::vector<std::int64_t> dataPointCheckpointOffsets;
+    std::vector<std::int64_t> rowFieldCounts;
+
+    readSizedBuffer(inputStream,rowOffsets,indexedDataLength + 1);
+    readSizedBuffer(inputStream,dataPointCheckpointOffsets,indexedDataLength + 1);
+    readSizedBuffer(inputStream,rowFieldCounts,indexedDataLength + 1);
+
+    if(!inputStream)
+        return false;
+
+
+
+    // A corrupted index must not make
+    // the iterator point outside of the
+    // data, and the index must hold what
+    // the user asked for (a row index, the
+    // same checkpoint interval, the same
+    // ragged rows mode and the same comment
+    // prefixes and number of header rows)
+
+    auto isOffsetValid = [dataLength](const std::int64_t& offset)
+    {
+        return offset >= 0 && offset <= dataLength;
+    };
+
+    if(rows < 0 ||
+       colsInData < 0 ||
+       rows > dataLength ||
+       colsInData > dataLength ||
+       !isOffsetValid(firstDataPointOffset) ||
+       (lastRowBeginOffset != -1 && !isOffsetValid(lastRowBeginOffset)) ||
+       (!rowOffsets.empty() && static_cast<std::int64_t>(rowOffsets.size()) != rows) ||
+       !std::all_of(rowOffsets.begin(),rowOffsets.end(),isOffsetValid) ||
+       !std::all_of(dataPointCheckpointOffsets.begin(),dataPointCheckpointOffsets.end(),isOffsetValid) ||
+       (m_layout->m_shouldRowIndexBeBuilt && rowOffsets.empty() && rows > 0) ||
+       dataPointCheckpointInterval != m_layout->m_dataPointCheckpointInterval ||
+       (shouldRaggedRowsBeHandled != 0) != m_layout->m_shouldRaggedRowsBeHandled ||
+       numberOfHeaderRows != m_layout->m_numberOfHeaderRows ||
+       commentPrefixes != m_layout->m_commentPrefixes ||
+       (shouldRaggedRowsBeHandled != 0 && static_cast<std::int64_t>(rowFieldCounts.size()) != rows) ||
+       std::any_of(rowFieldCounts.begin(),rowFieldCounts.end(),[colsInData](const std::int64_t& count){return (count < 0 || count > colsInData);}))
+    {
+        return false;
+    }
+
+
+
+    // Everything checks out, so we
+    // start a new layout (the current
+    // one might be shared with copies
+    // of this iterator)
+
+    auto layout = std::make_shared<blCSVMatrixLayout>();
+
+    layout->m_rowTokens = rowTokens;
+    layout->m_colTokens = colTokens;
+    layout->m_rowAndColTokensCombined = rowTokens + colTokens;
+    layout->m_rowAndColTokenSet = blTokenSet(layout->m_rowAndColTokensCombined);
+    layout->m_rowTokenScanner = blSIMDTokenScanner(rowTokens);
+    layout->m_colTokenScanner = blSIMDTokenScanner(colTokens);
+    layout->m_rowAndColTokenScanner = blSIMDTokenScanner(layout->m_rowAndColTokensCombined);
+    layout->m_quoteTokenScanner = blSIMDTokenScanner(&s_quoteToken,&s_quoteToken + 1);
+    layout->m_hasQuotedFields = (hasQuotedFields != 0);
+    layout->m_rows = static_cast<std::ptrdiff_t>(rows);
+    layout->m_colsInData = static_cast<std::ptrdiff_t>(colsInData);
+    layout->m_columnNamesInData = std::move(columnNamesInData);
+    layout->m_shouldRowIndexBeBuilt = !rowOffsets.empty() || m_layout->m_shouldRowIndexBeBuilt;
+    layout->m_rowOffsets.assign(rowOffsets.begin(),rowOffsets.end());
+    layout->m_shouldRaggedRowsBeHandled = (shouldRaggedRowsBeHandled != 0);
+    layout->m_rowFieldCounts.assign(rowFieldCounts.begin(),rowFieldCounts.end());
+    layout->m_dataPointCheckpointInterval = static_cast<std::ptrdiff_t>(dataPointCheckpointInterval);
+    layout->m_commentPrefixes = std::move(commentPrefixes);
+    layout->m_numberOfHeaderRows = static_cast<std::ptrdiff_t>(numberOfHeaderRows);
+    layout->m_dataPointCheckpointOffsets.assign(dataPointCheckpointOffsets.begin(),dataPointCheckpointOffsets.end());
+    layout->m_lastRowBeginOffset = static_cast<std::ptrdiff_t>(lastRowBeginOffset);
+    layout->m_projectedColIndexes = m_layout->m_projectedColIndexes;
+
+    m_layout = std::move(layout);
+
+    m_rowCursors.reset();
+
+    m_firstDataPointIter = m_beginIter;
+    std::advance(m_firstDataPointIter,static_cast<std::ptrdiff_t>(firstDataPointOffset));
+
+    m_number = 0;
+
+    applyColumnProjection();
+
+    pointToTheFirstDataPoint();
+
+    convertToNumberFromCurrentPosition();
+
+    return true;
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline bool blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::loadIndex(const std::string& indexFilePath)
+{
+    std::ifstream indexFile(indexFilePath,std::ios::binary);
+
+    if(!indexFile)
+        return false;
+
+    return loadIndex(indexFile);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used to get the class' members
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline const blDataIteratorType& blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::getBeginIter()const
+{
+    return m_beginIter;
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline const blDataIteratorType& blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::getEndIter()const
+{
+    return m_endIter;
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline const blDataIteratorType& blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::getIter()const
+{
+    return m_iter;
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline const blDataIteratorType& blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::getFirstDataPointIter()const
+{
+    return m_firstDataPointIter;
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline const blNumberType& blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::getNumber()const
+{
+    return m_number;
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline const std::ptrdiff_t& blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::rows()const
+{
+    return m_layout->m_rows;
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline const std::ptrdiff_t& blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::cols()const
+{
+    return m_layout->m_cols;
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline const std::size_t& blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::size()const
+{
+    return m_layout->m_size;
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline const std::size_t& blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::length()const
+{
+    return m_layout->m_size;
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline const std::ptrdiff_t& blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::rowIndex()const
+{
+    return m_rowIndex;
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline const std::ptrdiff_t& blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::colIndex()const
+{
+    return m_colIndex;
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline const std::string& blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::rowTokens()const
+{
+    return m_layout->m_rowTokens;
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline const std::string& blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::colTokens()const
+{
+    return m_layout->m_colTokens;
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline const std::vector<std::string>& blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::getColumnNames()const
+{
+    return m_layout->m_columnNames;
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline const std::vector<std::string>& blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::getColumnNamesInData()const
+{
+    return m_layout->m_columnNamesInData;
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline const bool& blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::hasQuotedFields()const
+{
+    return m_layout->m_hasQuotedFields;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used to select (project) the columns
+// exposed by the iterator
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline void blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::setColumnProjection(const std::vector<std::ptrdiff_t>& colIndexesInData)
+{
+    makeLayoutUnique();
+
+    m_layout->m_projectedColIndexes = colIndexesInData;
+
+    applyColumnProjection();
+
+
+
+    // The row cursors count the columns
+    // of the csv data, so they're still
+    // valid, we just move to the new
+    // first data point
+
+    moveToTheBeginning();
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline void blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::setColumnProjection(const std::vector<std::string>& colNames)
+{
+    std::vector<std::ptrdiff_t> colIndexesInData;
+
+    for(const auto& colName : colNames)
+    {
+        auto colNameIter = std::find(m_layout->m_columnNamesInData.begin(),
+                                     m_layout->m_columnNamesInData.end(),
+                                     colName);
+
+        if(colNameIter != m_layout->m_columnNamesInData.end())
+            colIndexesInData.push_back(std::distance(m_layout->m_columnNamesInData.begin(),colNameIter));
+    }
+
+    setColumnProjection(colIndexesInData);
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline void blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::clearColumnProjection()
+{
+    setColumnProjection(std::vector<std::ptrdiff_t>());
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline bool blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::isColumnProjected()const
+{
+    return !m_layout->m_projectedColIndexes.empty();
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline const std::vector<std::ptrdiff_t>& blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::getColumnProjection()const
+{
+    return m_layout->m_projectedColIndexes;
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline const std::ptrdiff_t& blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::colsInData()const
+{
+    return m_layout->m_colsInData;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used to enable/disable the row index
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline void blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::setShouldRowIndexBeBuilt(const bool& shouldRowIndexBeBuilt)
+{
+    if(m_layout->m_shouldRowIndexBeBuilt == shouldRowIndexBeBuilt)
+        return;
+
+    // The ragged rows mode
+    // needs the row index
+
+    if(!shouldRowIndexBeBuilt && m_layout->m_shouldRaggedRowsBeHandled)
+        return;
+
+    makeLayoutUnique();
+
+    m_layout->m_shouldRowIndexBeBuilt = shouldRowIndexBeBuilt;
+
+    setIterators(m_beginIter,
+                 m_endIter,
+                 m_layout->m_rowTokens,
+                 m_layout->m_colTokens);
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline const bool& blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::getShouldRowIndexBeBuilt()const
+{
+    return m_layout->m_shouldRowIndexBeBuilt;
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline bool blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::isRowIndexBuilt()const
+{
+    return (m_layout->m_shouldRowIndexBeBuilt &&
+            static_cast<std::ptrdiff_t>(m_layout->m_rowOffsets.size()) == m_layout->m_rows);
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline const std::vector<std::ptrdiff_t>& blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::getRowOffsets()const
+{
+    return m_layout->m_rowOffsets;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used to enable/disable the ragged rows mode
+// and to set/get the missing value
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline void blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::setShouldRaggedRowsBeHandled(const bool& shouldRaggedRowsBeHandled)
+{
+    if(m_layout->m_shouldRaggedRowsBeHandled == shouldRaggedRowsBeHandled)
+        return;
+
+    makeLayoutUnique();
+
+    m_layout->m_shouldRaggedRowsBeHandled = shouldRaggedRowsBeHandled;
+
+    if(shouldRaggedRowsBeHandled)
+        m_layout->m_shouldRowIndexBeBuilt = true;
+
+    setIterators(m_beginIter,
+                 m_endIter,
+                 m_layout->m_rowTokens,
+                 m_layout->m_colTokens);
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline const bool& blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::getShouldRaggedRowsBeHandled()const
+{
+    return m_layout->m_shouldRaggedRowsBeHandled;
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline bool blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::areRowFieldCountsBuilt()const
+{
+    return (m_layout->m_shouldRaggedRowsBeHandled &&
+            isRowIndexBuilt() &&
+            static_cast<std::ptrdiff_t>(m_layout->m_rowFieldCounts.size()) == m_layout->m_rows);
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline const std::vector<std::ptrdiff_t>& blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::getRowFieldCounts()const
+{
+    return m_layout->m_rowFieldCounts;
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline void blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::setMissingValue(const blNumberType& missingValue)
+{
+    m_missingValue = missingValue;
+
+    if(isCurrentDataPointMissing())
+        m_number = m_missingValue;
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline void blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::setNumberConverter(const blNumberConverterType& numberConverter)
+{
+    m_numberConverter = numberConverter;
+
+    convertToNumberFromCurrentPosition();
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline const blNumberConverterType& blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::getNumberConverter()const
+{
+    return m_numberConverter;
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline const blNumberType& blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::getMissingValue()const
+{
+    return m_missingValue;
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline bool blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::isCurrentDataPointMissing()const
+{
+    return (areRowFieldCountsBuilt() &&
+            m_dataIndex < static_cast<std::ptrdiff_t>(m_layout->m_size) &&
+            getColIndexInData(m_colIndex) >= m_layout->m_rowFieldCounts[m_rowIndex]);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used to set/get the data point checkpoints
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline void blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::setDataPointCheckpointInterval(const std::ptrdiff_t& dataPointCheckpointInterval)
+{
+    if(m_layout->m_dataPointCheckpointInterval == dataPointCheckpointInterval)
+        return;
+
+    makeLayoutUnique();
+
+    m_layout->m_dataPointCheckpointInterval = dataPointCheckpointInterval;
+
+    setIterators(m_beginIter,
+                 m_endIter,
+                 m_layout->m_rowTokens,
+                 m_layout->m_colTokens);
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline const std::ptrdiff_t& blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::getDataPointCheckpointInterval()const
+{
+    return m_layout->m_dataPointCheckpointInterval;
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline bool blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::areDataPointCheckpointsBuilt()const
+{
+    return (m_layout->m_dataPointCheckpointInterval > 0 &&
+            !m_layout->m_dataPointCheckpointOffsets.empty());
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline const std::vector<std::ptrdiff_t>& blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::getDataPointCheckpointOffsets()const
+{
+    return m_layout->m_dataPointCheckpointOffsets;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used to set/get the comment prefixes
+// and the number of header rows
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline void blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::setCommentPrefixes(const std::vector<std::string>& commentPrefixes)
+{
+    if(m_layout->m_commentPrefixes == commentPrefixes)
+        return;
+
+    makeLayoutUnique();
+
+    m_layout->m_commentPrefixes = commentPrefixes;
+
+    setIterators(m_beginIter,
+                 m_endIter,
+                 m_layout->m_rowTokens,
+                 m_layout->m_colTokens);
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline const std::vector<std::string>& blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::getCommentPrefixes()const
+{
+    return m_layout->m_commentPrefixes;
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline void blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::setNumberOfHeaderRows(const std::ptrdiff_t& numberOfHeaderRows)
+{
+    // Any negative number means
+    // the title row is detected
+
+    std::ptrdiff_t newNumberOfHeaderRows = std::max(numberOfHeaderRows,std::ptrdiff_t(-1));
+
+    if(m_layout->m_numberOfHeaderRows == newNumberOfHeaderRows)
+        return;
+
+    makeLayoutUnique();
+
+    m_layout->m_numberOfHeaderRows = newNumberOfHeaderRows;
+
+    setIterators(m_beginIter,
+                 m_endIter,
+                 m_layout->m_rowTokens,
+                 m_layout->m_colTokens);
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline const std::ptrdiff_t& blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::getNumberOfHeaderRows()const
+{
+    return m_layout->m_numberOfHeaderRows;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used to set/get the advancing iterator method
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline const blAdvancingIteratorMethod& blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::getAdvancingIteratorMethod()const
+{
+    return m_advancingIteratorMethod;
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline void blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::setAdvancingIteratorMethod(const blAdvancingIteratorMethod& advancingIteratorMethod)
+{
+    m_advancingIteratorMethod = advancingIteratorMethod;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used to move the current iterator position
+// to the beginning or to the end
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>& blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::moveToTheBeginning()
+{
+    // We set everything back to the beginning
+    // of the supplied csv data stream
+
+    // If the supplied csv data size is zero
+    // then we set everything to the end
+
+    pointToTheFirstDataPoint();
+
+    convertToNumberFromCurrentPosition();
+
+    return (*this);
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>& blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::moveToTheEnd()
+{
+    // We set everything to point to the end
+    // of the supplied binary data stream
+
+    m_iter = m_endIter;
+
+    m_dataIndex = m_layout->m_size;
+    m_rowIndex = m_layout->m_rows;
+    m_colIndex = m_layout->m_cols;
+
+    return (*this);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions use to get the begin/end iterators
+// so that this smart iterator can work with
+// stl algorithms
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType> blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::begin()const
+{
+    auto copiedSmartIterator = (*this);
+
+    copiedSmartIterator.moveToTheBeginning();
+
+    return copiedSmartIterator;
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType> blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::end()const
+{
+    auto copiedSmartIterator = (*this);
+
+    copiedSmartIterator.moveToTheEnd();
+
+    return copiedSmartIterator;
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline blCSVMatrixIterator<const blDataIteratorType,blNumberType,blNumberConverterType> blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::cbegin()const
+{
+    auto copiedSmartIterator = (*this);
+
+    copiedSmartIterator.moveToTheBeginning();
+
+    return copiedSmartIterator;
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline blCSVMatrixIterator<const blDataIteratorType,blNumberType,blNumberConverterType> blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::cend()const
+{
+    auto copiedSmartIterator = (*this);
+
+    copiedSmartIterator.moveToTheEnd();
+
+    return copiedSmartIterator;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to convert the text we're currently
+// pointing to into a number, this function is called
+// internally everytime the iterator is moved to a different
+// location in the text
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline void blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::convertToNumberFromCurrentPosition()
+{
+    if(isCurrentDataPointMissing())
+    {
+        m_number = m_missingValue;
+        return;
+    }
+
+    convertFieldToNumber(m_iter,m_number);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used to find, count and record the offsets
+// of fields, respecting quotes only when the csv data
+// has any
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+template<typename blIntegerType>
+
+inline blIntegerType blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::findBeginningOfNthField(const blDataIteratorType& beginIter,
+                                                                                                                         const blDataIteratorType& endIter,
+                                                                                                                         const blSIMDTokenScanner& tokenScanner,
+                                                                                                                         const blIntegerType& whichFieldToFind,
+                                                                                                                         blDataIteratorType& nthFieldBeginIter)const
+{
+    if(m_layout->m_hasQuotedFields)
+    {
+        return blAlgorithmsLIB::findBeginningOfNthDataPointRespectingQuotes(beginIter,
+                                                                            endIter,
+                                                                            tokenScanner,
+                                                                            false,
+                                                                            m_layout->m_quoteTokenScanner,
+                                                                            whichFieldToFind,
+                                                                            nthFieldBeginIter);
+    }
+
+    return blAlgorithmsLIB::findBeginningOfNthDataPoint(beginIter,
+                                                        endIter,
+                                                        tokenScanner,
+                                                        false,
+                                                        whichFieldToFind,
+                                                        nthFieldBeginIter);
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+template<typename blIntegerType>
+
+inline blIntegerType blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::findBeginAndEndOfNthField(const blDataIteratorType& beginIter,
+                                                                                                                           const blDataIteratorType& endIter,
+                                                                                                                           const std::string& tokens,
+                                                                                                                           const blIntegerType& whichFieldToFind,
+                                                                                                                           blDataIteratorType& nthFieldBeginIter,
+                                                                                                                           blDataIteratorType& nthFieldEndIter)const
+{
+    if(m_layout->m_hasQuotedFields)
+    {
+        return blAlgorithmsLIB::findBeginAndEndOfNthDataPointRespectingQuotes(beginIter,
+                                                                              endIter,
+                                                                              tokens.begin(),
+                                                                              tokens.end(),
+                                                                              false,
+                                                                              s_quoteToken,
+                                                                              whichFieldToFind,
+                                                                              nthFieldBeginIter,
+                                                                              nthFieldEndIter);
+    }
+
+    return blAlgorithmsLIB::findBeginAndEndOfNthDataPoint(beginIter,
+                                                          endIter,
+                                                          tokens.begin(),
+                                                          tokens.end(),
+                                                          false,
+                                                          whichFieldToFind,
+                                                          nthFieldBeginIter,
+                                                          nthFieldEndIter);
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline std::size_t blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::countFields(const blDataIteratorType& beginIter,
+                                                                                                           const blDataIteratorType& endIter,
+                                                                                                           const blSIMDTokenScanner& tokenScanner)const
+{
+    if(m_layout->m_hasQuotedFields)
+    {
+        return blAlgorithmsLIB::countDataRowsRespectingQuotes(beginIter,
+                                                              endIter,
+                                                              tokenScanner,
+                                                              false,
+                                                              m_layout->m_quoteTokenScanner);
+    }
+
+    return blAlgorithmsLIB::countDataRows(beginIter,
+                                          endIter,
+                                          tokenScanner,
+                                          false);
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline std::size_t blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::findOffsetsOfAllFields(const blDataIteratorType& beginIter,
+                                                                                                                      const blDataIteratorType& endIter,
+                                                                                                                      const std::string& tokens,
+                                                                                                                      std::vector<std::ptrdiff_t>& fieldOffsets)const
+{
+    if(m_layout->m_hasQuotedFields)
+    {
+        return blAlgorithmsLIB::findOffsetsOfAllDataRowsRespectingQuotes(beginIter,
+                                                                         endIter,
+                                                                         tokens.begin(),
+                                                                         tokens.end(),
+                                                                         false,
+                                                                         s_quoteToken,
+                                                                         m_beginIter,
+                                                                         fieldOffsets);
+    }
+
+    return blAlgorithmsLIB::findOffsetsOfAllDataRows(beginIter,
+                                                     endIter,
+                                                     tokens.begin(),
+                                                     tokens.end(),
+                                                     false,
+                                                     m_beginIter,
+                                                     fieldOffsets);
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline std::ptrdiff_t blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::findOffsetsOfEveryNthField(const blDataIteratorType& beginIter,
+                                                                                                                             const blDataIteratorType& endIter,
+                                                                                                                             const std::string& tokens,
+                                                                                                                             const std::ptrdiff_t& intervalBetweenRecordedFields,
+                                                                                                                             std::vector<std::ptrdiff_t>& fieldOffsets)const
+{
+    if(m_layout->m_hasQuotedFields)
+    {
+        return blAlgorithmsLIB::findOffsetsOfEveryNthDataPointRespectingQuotes(beginIter,
+                                                                               endIter,
+                                                                               tokens.begin(),
+                                                                               tokens.end(),
+                                                                               false,
+                                                                               s_quoteToken,
+                                                                               intervalBetweenRecordedFields,
+                                                                               m_beginIter,
+                                                                               fieldOffsets);
+    }
+
+    return blAlgorithmsLIB::findOffsetsOfEveryNthDataPoint(beginIter,
+                                                           endIter,
+                                                           tokens.begin(),
+                                                           tokens.end(),
+                                                           false,
+                                                           intervalBetweenRecordedFields,
+                                                           m_beginIter,
+                                                           fieldOffsets);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to copy the contents of a quoted field
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline blDataIteratorType blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::copyQuotedField(const blDataIteratorType& fieldBeginIter,
+                                                                                                                      const blDataIteratorType& endIter,
+                                                                                                                      std::string& fieldContents)
+{
+    auto currentIter = fieldBeginIter;
+
+    // Skip the opening quote
+
+    if(currentIter != endIter)
+        ++currentIter;
+
+
+
+    while(currentIter != endIter)
+    {
+        if((*currentIter) == s_quoteToken)
+        {
+            ++currentIter;
+
+            // Two quotes in a row are
+            // an escaped quote, while a
+            // single one closes the field
+
+            if(currentIter != endIter && (*currentIter) == s_quoteToken)
+            {
+                fieldContents += s_quoteToken;
+                ++currentIter;
+            }
+            else
+                break;
+        }
+        else
+        {
+            fieldContents += static_cast<char>(*currentIter);
+            ++currentIter;
+        }
+    }
+
+
+
+    return currentIter;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to copy the contents of a field
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline blDataIteratorType blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::copyField(const blDataIteratorType& fieldBeginIter,
+                                                                                                                std::string& fieldContents)const
+{
+    fieldContents.clear();
+
+    if(m_layout->m_hasQuotedFields &&
+       fieldBeginIter != m_endIter &&
+       (*fieldBeginIter) == s_quoteToken)
+    {
+        return copyQuotedField(fieldBeginIter,m_endIter,fieldContents);
+    }
+
+
+
+    auto fieldEndIter = blAlgorithmsLIB::find_first_of(fieldBeginIter,
+                                                       m_endIter,
+                                                       m_layout->m_rowAndColTokenSet,
+                                                       0);
+
+    fieldContents.assign(fieldBeginIter,fieldEndIter);
+
+    return fieldEndIter;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to copy the contents of a quoted number
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline blDataIteratorType blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::copyQuotedNumber(const blDataIteratorType& fieldBeginIter,
+                                                                                                                       std::string& fieldContents)const
+{
+    fieldContents.clear();
+
+    auto fieldEndIter = copyQuotedField(fieldBeginIter,m_endIter,fieldContents);
+
+    fieldContents.erase(std::remove_if(fieldContents.begin(),
+                                       fieldContents.end(),
+                                       [this](const char& character){return (m_layout->m_colTokens.find(character) != std::string::npos);}),
+                        fieldContents.end());
+
+    return fieldEndIter;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used to convert a field into a number
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+template<typename blFieldNumberType>
+
+inline blDataIteratorType blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::convertFieldToNumber(const blDataIteratorType& fieldBeginIter,
+                                                                                                                           blFieldNumberType& number)const
+{
+    if(!m_layout->m_hasQuotedFields ||
+       fieldBeginIter == m_endIter ||
+       (*fieldBeginIter) != s_quoteToken)
+    {
+        return m_numberConverter(fieldBeginIter,m_endIter,number);
+    }
+
+
+
+    // The field is quoted, so we unquote
+    // it and drop any column tokens in it
+    // before converting it
+
+    std::string fieldContents;
+
+    auto fieldEndIter = copyQuotedNumber(fieldBeginIter,fieldContents);
+
+    number = blFieldNumberType(0);
+
+    m_numberConverter(fieldContents.cbegin(),fieldContents.cend(),number);
+
+    return fieldEndIter;
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+template<typename blIntegerType>
+
+inline blDataIteratorType blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::convertFieldToInteger(const blDataIteratorType& fieldBeginIter,
+                                                                                                                            blIntegerType& integer)const
+{
+    if(!m_layout->m_hasQuotedFields ||
+       fieldBeginIter == m_endIter ||
+       (*fieldBeginIter) != s_quoteToken)
+    {
+        return blAlgorithmsLIB::convertToInteger(fieldBeginIter,m_endIter,integer);
+    }
+
+
+
+    std::string fieldContents;
+
+    auto fieldEndIter = copyQuotedNumber(fieldBeginIter,fieldContents);
+
+    blAlgorithmsLIB::convertToInteger(fieldContents.cbegin(),fieldContents.cend(),integer);
+
+    return fieldEndIter;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used to convert a field into a number while
+// telling whether the whole field was a number
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+template<typename blFieldNumberType>
+
+inline blDataIteratorType blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::convertFieldToNumber(const blDataIteratorType& fieldBeginIter,
+                                                                                                                           blFieldNumberType& number,
+                                                                                                                           bool& isFieldANumber)const
+{
+    // The number has to end where
+    // the field ends
+
+    if(!m_layout->m_hasQuotedFields ||
+       fieldBeginIter == m_endIter ||
+       (*fieldBeginIter) != s_quoteToken)
+    {
+        auto numberEndIter = m_numberConverter(fieldBeginIter,m_endIter,number);
+
+        isFieldANumber = (numberEndIter == m_endIter || m_layout->m_rowAndColTokenSet.isToken(*numberEndIter));
+
+        return numberEndIter;
+    }
+
+
+
+    std::string fieldContents;
+
+    auto fieldEndIter = copyQuotedNumber(fieldBeginIter,fieldContents);
+
+    number = blFieldNumberType(0);
+
+    isFieldANumber = (m_numberConverter(fieldContents.cbegin(),fieldContents.cend(),number) == fieldContents.cend());
+
+    return fieldEndIter;
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+template<typename blIntegerType>
+
+inline blDataIteratorType blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::convertFieldToInteger(const blDataIteratorType& fieldBeginIter,
+                                                                                                                            blIntegerType& integer,
+                                                                                                                            bool& isFieldANumber)const
+{
+    bool hasIntegerFit = true;
+
+    if(!m_layout->m_hasQuotedFields ||
+       fieldBeginIter == m_endIter ||
+       (*fieldBeginIter) != s_quoteToken)
+    {
+        auto integerEndIter = blAlgorithmsLIB::convertToInteger(fieldBeginIter,m_endIter,integer,hasIntegerFit);
+
+        isFieldANumber = (hasIntegerFit &&
+                          (integerEndIter == m_endIter || m_layout->m_rowAndColTokenSet.isToken(*integerEndIter)));
+
+        return integerEndIter;
+    }
+
+
+
+    std::string fieldContents;
+
+    auto fieldEndIter = copyQuotedNumber(fieldBeginIter,fieldContents);
+
+    isFieldANumber = (blAlgorithmsLIB::convertToInteger(fieldContents.cbegin(),fieldContents.cend(),integer,hasIntegerFit) == fieldContents.cend() &&
+                      hasIntegerFit);
+
+    return fieldEndIter;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to convert a field that doesn't fit the
+// type of its typed column
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline blDataIteratorType blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::convertFieldWideningColumn(const blDataIteratorType& fieldBeginIter,
+                                                                                                                                 const std::ptrdiff_t& rowIndex,
+                                                                                                                                 blCSVTypedColumn& column)const
+{
+    // A field that is not a number at
+    // all doesn't widen the column, its
+    // row is marked instead
+
+    double number = 0;
+    bool isFieldANumber = true;
+
+    auto fieldEndIter = convertFieldToNumber(fieldBeginIter,number,isFieldANumber);
+
+    if(!isFieldANumber)
+    {
+        column.markRowAsUnparsable(static_cast<std::size_t>(rowIndex));
+        return fieldEndIter;
+    }
+
+
+
+    // An integer too big for a 32 bits
+    // column widens it to 64 bits, any
+    // other number widens the column to
+    // doubles
+
+    if(column.getColumnType() == INT32_COLUMN)
+    {
+        std::int64_t integer = 0;
+
+        convertFieldToInteger(fieldBeginIter,integer,isFieldANumber);
+
+        if(isFieldANumber)
+        {
+            column.widenColumnType(INT64_COLUMN);
+            column.getInt64Values()[rowIndex] = integer;
+            return fieldEndIter;
+        }
+    }
+
+    column.widenColumnType(DOUBLE_COLUMN);
+    column.getDoubleValues()[rowIndex] = number;
+
+    return fieldEndIter;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used to visit the fields of consecutive data rows
+// in one forward pass, this avoids the bookkeeping done by
+// the iterator every time it is moved
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+template<typename blFieldFunctorType>
+
+inline std::size_t blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::forEachField(const blDataIteratorType& beginIter,
+                                                                                     const blDataIteratorType& endIter,
+                                                                                     const std::ptrdiff_t& firstRowIndex,
+                                                                                     const std::ptrdiff_t& numberOfRows,
+                                                                                     blFieldFunctorType& fieldFunctor)const
+{
+    // When columns are projected (or rows
+    // are ragged) we visit the projected
+    // columns in the order they appear in
+    // the csv data
+
+    if(isColumnProjected() || areRowFieldCountsBuilt())
+    {
+        std::vector< std::pair<std::ptrdiff_t,std::ptrdiff_t> > colsInDataOrder;
+
+        for(std::ptrdiff_t i = 0; i < m_layout->m_cols; ++i)
+            colsInDataOrder.push_back(std::make_pair(getColIndexInData(i),i));
+
+        std::sort(colsInDataOrder.begin(),colsInDataOrder.end());
+
+        return forEachFieldOfColumns(beginIter,
+                                     endIter,
+                                     firstRowIndex,
+                                     numberOfRows,
+                                     colsInDataOrder,
+                                     fieldFunctor);
+    }
+
+
+
+    auto currentIter = beginIter;
+
+    std::size_t numberOfFieldsVisited = 0;
+
+    std::ptrdiff_t cols = m_layout->m_cols;
+
+    std::size_t numberOfFieldsToVisit = static_cast<std::size_t>(std::max(numberOfRows * cols,std::ptrdiff_t(0)));
+
+    while(numberOfFieldsVisited < numberOfFieldsToVisit)
+    {
+        // We skip any row or column
+        // tokens to get to the beginning
+        // of the next field
+
+        currentIter = blAlgorithmsLIB::find_first_not_of(currentIter,
+                                                         endIter,
+                                                         m_layout->m_rowAndColTokenSet,
+                                                         0);
+
+        if(currentIter == endIter)
+            break;
+
+
+
+        std::ptrdiff_t fieldIndex = static_cast<std::ptrdiff_t>(numberOfFieldsVisited);
+
+        currentIter = fieldFunctor(firstRowIndex + fieldIndex / cols,fieldIndex % cols,currentIter);
+
+        ++numberOfFieldsVisited;
+
+
+
+        // We then skip whatever is left
+        // of the field
+
+        currentIter = blAlgorithmsLIB::find_first_of(currentIter,
+                                                     endIter,
+                                                     m_layout->m_rowAndColTokenSet,
+                                                     0);
+    }
+
+
+
+    return numberOfFieldsVisited;
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+template<typename blFieldFunctorType>
+
+inline std::size_t blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::forEachFieldOfColumns(const blDataIteratorType& beginIter,
+                                                                                              const blDataIteratorType& endIter,
+                                                                                              const std::ptrdiff_t& firstRowIndex,
+                                                                                              const std::ptrdiff_t& numberOfRows,
+                                                                                              const std::vector< std::pair<std::ptrdiff_t,std::ptrdiff_t> >& colsInDataOrder,
+                                                                                              blFieldFunctorType& fieldFunctor)const
+{
+    auto currentIter = beginIter;
+
+    std::size_t numberOfFieldsVisited = 0;
+
+
+
+    // In the ragged rows mode, every row
+    // is visited from its beginning (given
+    // by the row index) up to its last
+    // field, the missing fields are not
+    // passed to the functor
+
+    if(areRowFieldCountsBuilt())
+    {
+        const auto& rowOffsets = m_layout->m_rowOffsets;
+
+        auto rowBeginIter = beginIter;
+        auto fieldBeginIter = beginIter;
+
+
+
+        for(std::ptrdiff_t rowIndex = firstRowIndex; rowIndex < firstRowIndex + numberOfRows; ++rowIndex)
+        {
+            if(rowIndex > firstRowIndex)
+                std::advance(rowBeginIter,rowOffsets[rowIndex] - rowOffsets[rowIndex - 1]);
+
+            currentIter = rowBeginIter;
+
+            std::ptrdiff_t colIndexInData = -1;
+
+            for(const auto& colInDataOrder : colsInDataOrder)
+            {
+                if(colInDataOrder.first >= m_layout->m_rowFieldCounts[rowIndex])
+                    break;
+
+                findBeginningOfNthField(currentIter,
+                                        endIter,
+                                        m_layout->m_rowAndColTokenScanner,
+                                        colInDataOrder.first - colIndexInData - 1,
+                                        fieldBeginIter);
+
+                currentIter = fieldFunctor(rowIndex,colInDataOrder.second,fieldBeginIter);
+
+                currentIter = blAlgorithmsLIB::find_first_of(currentIter,
+                                                             endIter,
+                                                             m_layout->m_rowAndColTokenSet,
+                                                             0);
+
+                colIndexInData = colInDataOrder.first;
+
+                ++numberOfFieldsVisited;
+            }
+        }
+
+        return numberOfFieldsVisited;
+    }
+
+
+
+    // Otherwise we jump over the unselected
+    // fields of each row without passing
+    // them to the functor
+
+    std::ptrdiff_t colIndexInData = -1;
+
+    auto fieldBeginIter = beginIter;
+
+
+
+    for(std::ptrdiff_t rowIndex = firstRowIndex; rowIndex < firstRowIndex + numberOfRows; ++rowIndex)
+    {
+        for(const auto& colInDataOrder : colsInDataOrder)
+        {
+            // We skip the fields between the
+            // last visited one and this one
+
+            std::ptrdiff_t numberOfFieldsToSkip = colInDataOrder.first - colIndexInData - 1;
+
+            std::ptrdiff_t numberOfFieldsSkipped = findBeginningOfNthField(currentIter,
+                                                                           endIter,
+                                                                           m_layout->m_rowAndColTokenScanner,
+                                                                           numberOfFieldsToSkip,
+                                                                           fieldBeginIter);
+
+            if(numberOfFieldsSkipped < numberOfFieldsToSkip)
+                return numberOfFieldsVisited;
+
+            currentIter = fieldFunctor(rowIndex,colInDataOrder.second,fieldBeginIter);
+
+            currentIter = blAlgorithmsLIB::find_first_of(currentIter,
+                                                         endIter,
+                                                         m_layout->m_rowAndColTokenSet,
+                                                         0);
+
+            colIndexInData = colInDataOrder.first;
+
+            ++numberOfFieldsVisited;
+        }
+
+
+
+        // The fields left in this row
+        // are skipped together with the
+        // ones at the beginning of the
+        // next row
+
+        colIndexInData -= m_layout->m_colsInData;
+    }
+
+    return numberOfFieldsVisited;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to parse the data points of consecutive
+// data rows in one forward pass
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+template<typename blFunctorType>
+
+inline std::size_t blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::parseDataPoints(const blDataIteratorType& beginIter,
+                                                                                        const blDataIteratorType& endIter,
+                                                                                        const std::ptrdiff_t& firstRowIndex,
+                                                                                        const std::ptrdiff_t& numberOfRows,
+                                                                                        blFunctorType& functor)const
+{
+    std::ptrdiff_t cols = m_layout->m_cols;
+
+    std::size_t numberOfDataPointsParsed = 0;
+
+
+
+    if(areRowFieldCountsBuilt())
+    {
+        // In the ragged rows mode, a row's
+        // values start as the missing value
+        // and the row is passed to the functor
+        // once the next row is reached (a row
+        // might not have any of the projected
+        // columns, in which case it's never
+        // visited)
+
+        std::vector<blNumberType> rowNumbers(cols,m_missingValue);
+
+        std::ptrdiff_t currentRowIndex = firstRowIndex;
+
+        auto passRowsBefore = [this,&functor,&cols,&rowNumbers,&currentRowIndex,&numberOfDataPointsParsed](const std::ptrdiff_t& rowIndex)
+        {
+            for(; currentRowIndex < rowIndex; ++currentRowIndex)
+            {
+                for(std::ptrdiff_t i = 0; i < cols; ++i)
+                    functor(static_cast<std::size_t>(currentRowIndex * cols + i),rowNumbers[i]);
+
+                numberOfDataPointsParsed += static_cast<std::size_t>(cols);
+
+                std::fill(rowNumbers.begin(),rowNumbers.end(),m_missingValue);
+            }
+        };
+
+        auto convertField = [this,&rowNumbers,&passRowsBefore](const std::ptrdiff_t& rowIndex,
+                                                               const std::ptrdiff_t& colIndex,
+                                                               const blDataIteratorType& fieldBeginIter)
+        {
+            passRowsBefore(rowIndex);
+
+            rowNumbers[colIndex] = blNumberType(0);
+
+            return convertFieldToNumber(fieldBeginIter,rowNumbers[colIndex]);
+        };
+
+        forEachField(beginIter,endIter,firstRowIndex,numberOfRows,convertField);
+
+        passRowsBefore(firstRowIndex + numberOfRows);
+    }
+    else if(!isColumnProjected())
+    {
+        blNumberType number = 0;
+
+        auto convertField = [this,&functor,&cols,&number](const std::ptrdiff_t& rowIndex,
+                                                          const std::ptrdiff_t& colIndex,
+                                                          const blDataIteratorType& fieldBeginIter)
+        {
+            // A non-valid number is
+            // interpreted as zero
+
+            number = blNumberType(0);
+
+            auto fieldEndIter = convertFieldToNumber(fieldBeginIter,number);
+
+            functor(static_cast<std::size_t>(rowIndex * cols + colIndex),number);
+
+            return fieldEndIter;
+        };
+
+        numberOfDataPointsParsed = forEachField(beginIter,endIter,firstRowIndex,numberOfRows,convertField);
+    }
+    else
+    {
+        // The fields of a row are visited
+        // in the order they appear in the
+        // csv data, so we collect the row's
+        // values and pass them to the functor
+        // in the projected order once the
+        // whole row has been converted
+
+        std::vector<blNumberType> rowNumbers(cols,blNumberType(0));
+
+        std::ptrdiff_t numberOfFieldsConvertedInRow = 0;
+
+        auto convertField = [this,&functor,&cols,&rowNumbers,&numberOfFieldsConvertedInRow,&numberOfDataPointsParsed](const std::ptrdiff_t& rowIndex,
+                                                                                                                      const std::ptrdiff_t& colIndex,
+                                                                                                                      const blDataIteratorType& fieldBeginIter)
+        {
+            rowNumbers[colIndex] = blNumberType(0);
+
+            auto fieldEndIter = convertFieldToNumber(fieldBeginIter,rowNumbers[colIndex]);
+
+            ++numberOfFieldsConvertedInRow;
+
+            if(numberOfFieldsConvertedInRow == cols)
+            {
+                for(std::ptrdiff_t i = 0; i < cols; ++i)
+                    functor(static_cast<std::size_t>(rowIndex * cols + i),rowNumbers[i]);
+
+                numberOfDataPointsParsed += static_cast<std::size_t>(cols);
+                numberOfFieldsConvertedInRow = 0;
+            }
+
+            return fieldEndIter;
+        };
+
+        forEachField(beginIter,endIter,firstRowIndex,numberOfRows,convertField);
+    }
+
+
+
+    return numberOfDataPointsParsed;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to read the next data points in
+// the advancing order in one call
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+template<typename blOutputIteratorType>
+
+inline std::size_t blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::fill(blOutputIteratorType outputIter,
+                                                                                                    const std::size_t& numberOfValues)
+{
+    std::size_t numberOfValuesRead = 0;
+
+
+
+    // Function used to read the data
+    // points one at a time, moving the
+    // iterator after each of them
+
+    auto readOneAtATime = [this,&outputIter,&numberOfValuesRead](const std::size_t& numberOfValuesToRead)
+    {
+        while(numberOfValuesRead < numberOfValuesToRead && m_iter != m_endIter)
+        {
+            (*outputIter) = m_number;
+            ++outputIter;
+            ++numberOfValuesRead;
+
+            moveIterator(1,m_advancingIteratorMethod);
+        }
+    };
+
+
+
+    // In a column-major way every data
+    // point is in a different row, so we
+    // let the row cursors find them
+
+    if(m_advancingIteratorMethod == COL_MAJOR ||
+       m_advancingIteratorMethod == COL_PAGE_MAJOR)
+    {
+        readOneAtATime(numberOfValues);
+        return numberOfValuesRead;
+    }
+
+
+
+    if(m_iter == m_endIter ||
+       m_dataIndex < 0 ||
+       m_dataIndex >= static_cast<std::ptrdiff_t>(m_layout->m_size))
+    {
+        return 0;
+    }
+
+    std::size_t numberOfValuesToRead = std::min(numberOfValues,m_layout->m_size - static_cast<std::size_t>(m_dataIndex));
+
+
+
+    if(!isColumnProjected() && !areRowFieldCountsBuilt())
+    {
+        // Every field is a data point, so
+        // we convert the fields one after
+        // the other from the current one
+
+        auto currentIter = m_iter;
+
+        blNumberType number = 0;
+
+        while(numberOfValuesRead < numberOfValuesToRead && currentIter != m_endIter)
+        {
+            // A non-valid number is
+            // interpreted as zero
+
+            number = blNumberType(0);
+
+            currentIter = convertFieldToNumber(currentIter,number);
+
+            (*outputIter) = number;
+            ++outputIter;
+            ++numberOfValuesRead;
+
+
+
+            // We then skip whatever is left
+            // of the field and any row or
+            // column tokens after it
+
+            currentIter = blAlgorithmsLIB::find_first_of(currentIter,
+                                                         m_endIter,
+                                                         m_layout->m_rowAndColTokenSet,
+                                                         0);
+
+            currentIter = blAlgorithmsLIB::find_first_not_of(currentIter,
+                                                             m_endIter,
+                                                             m_layout->m_rowAndColTokenSet,
+                                                             0);
+        }
+
+
+
+        // Finally we move the
+        // iterator only once
+
+        m_dataIndex += static_cast<std::ptrdiff_t>(numberOfValuesRead);
+
+        if(currentIter == m_endIter ||
+           m_dataIndex >= static_cast<std::ptrdiff_t>(m_layout->m_size))
+        {
+            moveToTheEnd();
+        }
+        else
+        {
+            m_iter = currentIter;
+            m_rowIndex = m_dataIndex / m_layout->m_cols;
+            m_colIndex = m_dataIndex % m_layout->m_cols;
+
+            convertToNumberFromCurrentPosition();
+        }
+
+        return numberOfValuesRead;
+    }
+
+
+
+    // Otherwise we read what is left of
+    // the current row one at a time
+
+    if(m_colIndex != 0)
+        readOneAtATime(std::min(numberOfValuesToRead,static_cast<std::size_t>(m_layout->m_cols - m_colIndex)));
+
+
+
+    // Then the whole rows are parsed in
+    // one forward pass from the beginning
+    // of the first one (given by the row
+    // index) and the iterator is moved
+    // past them only once
+
+    std::ptrdiff_t numberOfWholeRows = static_cast<std::ptrdiff_t>((numberOfValuesToRead - numberOfValuesRead) / static_cast<std::size_t>(m_layout->m_cols));
+
+    if(numberOfWholeRows > 0 &&
+       isRowIndexBuilt() &&
+       m_iter != m_endIter)
+    {
+        auto rowBeginIter = m_beginIter;
+        std::advance(rowBeginIter,m_layout->m_rowOffsets[m_rowIndex]);
+
+        auto writeRowMajor = [&outputIter](const std::size_t&,const blNumberType& number)
+        {
+            (*outputIter) = number;
+            ++outputIter;
+        };
+
+        std::size_t numberOfDataPointsParsed = parseDataPoints(rowBeginIter,m_endIter,m_rowIndex,numberOfWholeRows,writeRowMajor);
+
+        numberOfValuesRead += numberOfDataPointsParsed;
+
+        moveIterator(static_cast<std::ptrdiff_t>(numberOfDataPointsParsed),ROW_MAJOR);
+    }
+
+
+
+    // And the rest is read
+    // one at a time again
+
+    readOneAtATime(numberOfValuesToRead);
+
+    return numberOfValuesRead;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used to parse the whole numeric body of the
+// csv data in one forward pass into a contiguous buffer
+//
+// NOTE:  These functions convert the fields with the
+//        number converter of this iterator
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+template<typename blOutputIteratorType>
+
+inline std::size_t blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::materialize(blOutputIteratorType outputIter,
+                                                                                    const blAdvancingIteratorMethod& outputLayout)const
+{
+    if(m_layout->m_size == 0)
+        return 0;
+
+
+
+    if(outputLayout == COL_MAJOR ||
+       outputLayout == COL_PAGE_MAJOR)
+    {
+        // The data is parsed in a row-major
+        // way so we scatter it into the
+        // column-major output
+
+        std::ptrdiff_t rows = m_layout->m_rows;
+        std::ptrdiff_t cols = m_layout->m_cols;
+
+        auto writeColMajor = [&outputIter,&rows,&cols](const std::size_t& dataIndex,const blNumberType& number)
+        {
+            std::ptrdiff_t rowIndex = static_cast<std::ptrdiff_t>(dataIndex) / cols;
+            std::ptrdiff_t colIndex = static_cast<std::ptrdiff_t>(dataIndex) % cols;
+
+            outputIter[colIndex * rows + rowIndex] = number;
+        };
+
+        return parseDataPoints(m_firstDataPointIter,m_endIter,0,m_layout->m_rows,writeColMajor);
+    }
+    else
+    {
+        auto writeRowMajor = [&outputIter](const std::size_t&,const blNumberType& number)
+        {
+            (*outputIter) = number;
+            ++outputIter;
+        };
+
+        return parseDataPoints(m_firstDataPointIter,m_endIter,0,m_layout->m_rows,writeRowMajor);
+    }
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+template<typename blAllocatorType>
+
+inline std::size_t blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::materialize(std::vector<blNumberType,blAllocatorType>& matrix,
+                                                                                    const blAdvancingIteratorMethod& outputLayout)const
+{
+    matrix.assign(m_layout->m_size,blNumberType(0));
+
+    return materialize(matrix.begin(),outputLayout);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to split the csv data into chunks of whole
+// rows and to process the chunks concurrently
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+template<typename blChunkFunctorType>
+
+inline std::size_t blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::forEachRowAlignedChunkInParallel(const std::size_t& numberOfThreads,
+                                                                                                                                const blChunkFunctorType& chunkFunctor)const
+{
+    if(m_layout->m_size == 0)
+        return 0;
+
+
+
+    // We don't bother splitting
+    // small csv data, the threads
+    // would cost more than the
+    // parsing itself
+
+    const std::ptrdiff_t minimumChunkLength = 1 << 16;
+
+    std::ptrdiff_t dataLength = std::distance(m_firstDataPointIter,m_endIter);
+
+    std::size_t numberOfChunks = numberOfThreads;
+
+    if(numberOfChunks == 0)
+        numberOfChunks = std::max(std::thread::hardware_concurrency(),1u);
+
+    numberOfChunks = std::max(std::min(numberOfChunks,static_cast<std::size_t>(dataLength / minimumChunkLength)),
+                              static_cast<std::size_t>(1));
+
+
+
+    // When the row index is built we
+    // already know where every row begins,
+    // so the chunks are made of equal
+    // numbers of rows and nothing needs
+    // to be scanned
+    //
+    // Otherwise, a byte in the middle of
+    // quoted csv data could be inside a
+    // quoted field, so we can't snap chunks
+    // to row tokens without scanning from
+    // the beginning
+
+    bool isRowIndexUsable = (isRowIndexBuilt() &&
+                             static_cast<std::ptrdiff_t>(m_layout->m_rowOffsets.size()) == m_layout->m_rows);
+
+    if(m_layout->m_hasQuotedFields && !isRowIndexUsable)
+        numberOfChunks = 1;
+
+    if(isRowIndexUsable)
+        numberOfChunks = std::min(numberOfChunks,static_cast<std::size_t>(m_layout->m_rows));
+
+
+
+    std::vector<blDataIteratorType> chunkBoundaries(numberOfChunks + 1,m_endIter);
+    chunkBoundaries[0] = m_firstDataPointIter;
+
+    std::vector<std::size_t> chunkRowCounts(numberOfChunks,0);
+    std::vector<std::thread> threads;
+
+    if(isRowIndexUsable)
+    {
+        std::size_t rows = static_cast<std::size_t>(m_layout->m_rows);
+
+        for(std::size_t i = 0; i < numberOfChunks; ++i)
+        {
+            std::size_t firstRowIndex = i * rows / numberOfChunks;
+            std::size_t nextFirstRowIndex = (i + 1) * rows / numberOfChunks;
+
+            if(i > 0)
+            {
+                chunkBoundaries[i] = m_beginIter;
+                std::advance(chunkBoundaries[i],m_layout->m_rowOffsets[firstRowIndex]);
+            }
+
+            chunkRowCounts[i] = nextFirstRowIndex - firstRowIndex;
+        }
+    }
+    else
+    {
+        // We split the byte range into
+        // chunks of equal length and snap the
+        // beginning of each chunk to the place
+        // right after the next row token, so
+        // that every chunk holds whole rows
+
+        for(std::size_t i = 1; i < numberOfChunks; ++i)
+        {
+            auto boundaryIter = m_firstDataPointIter;
+            std::advance(boundaryIter,static_cast<std::ptrdiff_t>(i) * (dataLength / static_cast<std::ptrdiff_t>(numberOfChunks)));
+
+            if(std::distance(chunkBoundaries[i - 1],boundaryIter) < 0)
+                boundaryIter = chunkBoundaries[i - 1];
+
+            boundaryIter = blAlgorithmsLIB::find_first_of(boundaryIter,
+                                                          m_endIter,
+                                                          m_layout->m_rowTokens.begin(),
+                                                          m_layout->m_rowTokens.end(),
+                                                          0);
+
+            if(boundaryIter != m_endIter)
+                ++boundaryIter;
+
+            chunkBoundaries[i] = boundaryIter;
+        }
+
+
+
+        // We then count the rows in
+        // each chunk concurrently
+
+        for(std::size_t i = 0; i < numberOfChunks; ++i)
+        {
+            threads.push_back(std::thread([this,i,&chunkBoundaries,&chunkRowCounts]()
+            {
+                chunkRowCounts[i] = countFields(chunkBoundaries[i],
+                                                chunkBoundaries[i + 1],
+                                                m_layout->m_rowTokenScanner);
+            }));
+        }
+
+        for(auto& thread : threads)
+            thread.join();
+
+        threads.clear();
+    }
+
+
+
+    // A prefix sum of the row counts
+    // gives us the global index of the
+    // first row of each chunk
+
+    std::vector<std::ptrdiff_t> chunkFirstRowIndexes(numberOfChunks,0);
+
+    for(std::size_t i = 1; i < numberOfChunks; ++i)
+        chunkFirstRowIndexes[i] = chunkFirstRowIndexes[i - 1] + static_cast<std::ptrdiff_t>(chunkRowCounts[i - 1]);
+
+
+
+    // Finally we process all
+    // the chunks concurrently
+
+    for(std::size_t i = 0; i < numberOfChunks; ++i)
+    {
+        threads.push_back(std::thread([i,&chunkFunctor,&chunkBoundaries,&chunkFirstRowIndexes,&chunkRowCounts]()
+        {
+            chunkFunctor(i,
+                         chunkBoundaries[i],
+                         chunkBoundaries[i + 1],
+                         chunkFirstRowIndexes[i],
+                         static_cast<std::ptrdiff_t>(chunkRowCounts[i]));
+        }));
+    }
+
+    for(auto& thread : threads)
+        thread.join();
+
+
+
+    return numberOfChunks;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used to parse the whole numeric body of the
+// csv data concurrently into a contiguous buffer
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+template<typename blOutputIteratorType>
+
+inline std::size_t blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::materializeInParallel(blOutputIteratorType outputIter,
+                                                                                              const blAdvancingIteratorMethod& outputLayout,
+                                                                                              const std::size_t& numberOfThreads)const
+{
+    std::ptrdiff_t rows = m_layout->m_rows;
+    std::ptrdiff_t cols = m_layout->m_cols;
+
+    bool isOutputColMajor = (outputLayout == COL_MAJOR ||
+                             outputLayout == COL_PAGE_MAJOR);
+
+    std::atomic<std::size_t> totalNumberOfDataPointsParsed(0);
+
+
+
+    auto parseChunk = [this,&outputIter,&rows,&cols,&isOutputColMajor,&totalNumberOfDataPointsParsed](const std::size_t&,
+                                                                                                      const blDataIteratorType& chunkBeginIter,
+                                                                                                      const blDataIteratorType& chunkEndIter,
+                                                                                                      const std::ptrdiff_t& firstRowIndex,
+                                                                                                      const std::ptrdiff_t& numberOfRows)
+    {
+        if(firstRowIndex >= rows)
+            return;
+
+        std::ptrdiff_t numberOfRowsToParse = std::min(numberOfRows,rows - firstRowIndex);
+
+        auto write = [&outputIter,&rows,&cols,&isOutputColMajor](const std::size_t& dataIndex,const blNumberType& number)
+        {
+            if(isOutputColMajor)
+            {
+                std::ptrdiff_t rowIndex = static_cast<std::ptrdiff_t>(dataIndex) / cols;
+                std::ptrdiff_t colIndex = static_cast<std::ptrdiff_t>(dataIndex) % cols;
+
+                outputIter[colIndex * rows + rowIndex] = number;
+            }
+            else
+            {
+                outputIter[dataIndex] = number;
+            }
+        };
+
+        totalNumberOfDataPointsParsed += parseDataPoints(chunkBeginIter,
+                                                         chunkEndIter,
+                                                         firstRowIndex,
+                                                         numberOfRowsToParse,
+                                                         write);
+    };
+
+
+
+    forEachRowAlignedChunkInParallel(numberOfThreads,parseChunk);
+
+    return totalNumberOfDataPointsParsed;
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+template<typename blAllocatorType>
+
+inline std::size_t blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::materializeInParallel(std::vector<blNumberType,blAllocatorType>& matrix,
+                                                                                              const blAdvancingIteratorMethod& outputLayout,
+                                                                                              const std::size_t& numberOfThreads)const
+{
+    matrix.assign(m_layout->m_size,blNumberType(0));
+
+    return materializeInParallel(matrix.begin(),outputLayout,numberOfThreads);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to infer the type of each column from a
+// sample of the first data rows
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline std::vector<blColumnType> blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::inferColumnTypes(const std::ptrdiff_t& numberOfRowsToSample)const
+{
+    std::vector<blColumnTypeInference> columnTypeInferences(std::max(m_layout->m_cols,std::ptrdiff_t(0)));
+
+    std::string fieldContents;
+
+
+
+    auto classifyField = [this,&columnTypeInferences,&fieldContents](const std::ptrdiff_t&,
+                                                                     const std::ptrdiff_t& colIndex,
+                                                                     const blDataIteratorType& fieldBeginIter)
+    {
+        // Quoted fields are classified
+        // without their column tokens, so
+        // that for ex. "1,234" is a number
+
+        blDataIteratorType fieldEndIter = fieldBeginIter;
+
+        if(m_layout->m_hasQuotedFields && (*fieldBeginIter) == s_quoteToken)
+            fieldEndIter = copyQuotedNumber(fieldBeginIter,fieldContents);
+        else
+            fieldEndIter = copyField(fieldBeginIter,fieldContents);
+
+        columnTypeInferences[colIndex].addField(fieldContents.cbegin(),fieldContents.cend());
+
+        return fieldEndIter;
+    };
+
+    forEachField(m_firstDataPointIter,
+                 m_endIter,
+                 0,
+                 std::min(std::max(numberOfRowsToSample,std::ptrdiff_t(0)),m_layout->m_rows),
+                 classifyField);
+
+
+
+    std::vector<blColumnType> columnTypes;
+
+    for(const auto& columnTypeInference : columnTypeInferences)
+        columnTypes.push_back(columnTypeInference.getColumnType());
+
+    return columnTypes;
+}
 //-------------------------------------------------------------------
-// Functions use to get the begin/end iterators
-// so that this smart iterator can work with
-// stl algorithms
+
+
+
+//-------------------------------------------------------------------
+// Functions used to parse the whole csv data in one forward
+// pass into typed columns
 //-------------------------------------------------------------------
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline blCSVMatrixIterator<blDataIteratorType,blNumberType> blCSVMatrixIterator<blDataIteratorType,blNumberType>::begin()const
+inline std::size_t blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::materializeColumns(std::vector<blCSVTypedColumn>& columns,
+                                                                                           const std::vector<blColumnType>& columnTypes)const
 {
-    auto copiedSmartIterator = (*this);
+    columns.resize(std::max(m_layout->m_cols,std::ptrdiff_t(0)));
 
-    copiedSmartIterator.moveToTheBeginning();
+    for(std::size_t i = 0; i < columns.size(); ++i)
+    {
+        // Columns without a provided
+        // type are parsed as doubles
 
-    return copiedSmartIterator;
+        columns[i].reset(i < columnTypes.size() ? columnTypes[i] : DOUBLE_COLUMN,
+                         i < m_layout->m_columnNames.size() ? m_layout->m_columnNames[i] : std::string(),
+                         static_cast<std::size_t>(m_layout->m_rows));
+    }
+
+
+
+    std::string fieldContents;
+
+    auto convertField = [this,&columns,&fieldContents](const std::ptrdiff_t& rowIndex,
+                                                       const std::ptrdiff_t& colIndex,
+                                                       const blDataIteratorType& fieldBeginIter)
+    {
+        blCSVTypedColumn& column = columns[colIndex];
+
+        // The types were picked from a sample
+        // of the rows, so a field that doesn't
+        // fit its column's type widens the
+        // column (or marks its row when it's
+        // not a number)
+
+        bool isFieldANumber = true;
+
+        switch(column.getColumnType())
+        {
+        case INT32_COLUMN:
+        {
+            auto fieldEndIter = convertFieldToInteger(fieldBeginIter,column.getInt32Values()[rowIndex],isFieldANumber);
+
+            if(!isFieldANumber)
+                return convertFieldWideningColumn(fieldBeginIter,rowIndex,column);
+
+            return fieldEndIter;
+        }
+
+        case INT64_COLUMN:
+        {
+            auto fieldEndIter = convertFieldToInteger(fieldBeginIter,column.getInt64Values()[rowIndex],isFieldANumber);
+
+            if(!isFieldANumber)
+                return convertFieldWideningColumn(fieldBeginIter,rowIndex,column);
+
+            return fieldEndIter;
+        }
+
+        case FLOAT_COLUMN:
+        {
+            // The digits are accumulated in a
+            // double so that a float column is
+            // as accurate as the text allows
+
+            double number = 0;
+
+            auto fieldEndIter = convertFieldToNumber(fieldBeginIter,number,isFieldANumber);
+
+            if(!isFieldANumber ||
+               std::abs(number) > double(std::numeric_limits<float>::max()))
+            {
+                return convertFieldWideningColumn(fieldBeginIter,rowIndex,column);
+            }
+
+            column.getFloatValues()[rowIndex] = static_cast<float>(number);
+
+            return fieldEndIter;
+        }
+
+        case CATEGORICAL_COLUMN:
+        {
+            auto fieldEndIter = copyField(fieldBeginIter,fieldContents);
+
+            column.getCategoryCodes()[rowIndex] = column.getCategoryCode(fieldContents);
+
+            return fieldEndIter;
+        }
+
+        default:
+        {
+            auto fieldEndIter = convertFieldToNumber(fieldBeginIter,column.getDoubleValues()[rowIndex],isFieldANumber);
+
+            if(!isFieldANumber)
+                column.markRowAsUnparsable(static_cast<std::size_t>(rowIndex));
+
+            return fieldEndIter;
+        }
+        }
+    };
+
+    return forEachField(m_firstDataPointIter,m_endIter,0,m_layout->m_rows,convertField);
 }
 
 
 
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline blCSVMatrixIterator<blDataIteratorType,blNumberType> blCSVMatrixIterator<blDataIteratorType,blNumberType>::end()const
+inline std::size_t blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::materializeColumns(std::vector<blCSVTypedColumn>& columns,
+                                                                                           const std::ptrdiff_t& numberOfRowsToSample)const
 {
-    auto copiedSmartIterator = (*this);
+    return materializeColumns(columns,inferColumnTypes(numberOfRowsToSample));
+}
+//-------------------------------------------------------------------
 
-    copiedSmartIterator.moveToTheEnd();
 
-    return copiedSmartIterator;
+
+//-------------------------------------------------------------------
+// Function used to compute the statistics of every column
+// in one scan of the csv data
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline std::size_t blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::computeColumnStatistics(std::vector<blColumnStatistics>& columnStatistics,
+                                                                                                const std::size_t& numberOfThreads)const
+{
+    std::size_t cols = static_cast<std::size_t>(std::max(m_layout->m_cols,std::ptrdiff_t(0)));
+
+    columnStatistics.assign(cols,blColumnStatistics());
+
+
+
+    // Each chunk computes its own partial
+    // statistics, which are then merged in
+    // the order of the chunks so that the
+    // result does not depend on the order
+    // in which the threads finish
+
+    std::vector< std::pair<std::size_t,std::vector<blColumnStatistics> > > chunkStatistics;
+    std::mutex chunkStatisticsMutex;
+
+    std::atomic<std::size_t> totalNumberOfFieldsVisited(0);
+
+
+
+    auto computeChunkStatistics = [this,&cols,&chunkStatistics,&chunkStatisticsMutex,&totalNumberOfFieldsVisited](const std::size_t& chunkIndex,
+                                                                                                                 const blDataIteratorType& chunkBeginIter,
+                                                                                                                 const blDataIteratorType& chunkEndIter,
+                                                                                                                 const std::ptrdiff_t& firstRowIndex,
+                                                                                                                 const std::ptrdiff_t& numberOfRows)
+    {
+        std::vector<blColumnStatistics> statistics(cols);
+
+        auto addField = [this,&statistics](const std::ptrdiff_t&,
+                                           const std::ptrdiff_t& colIndex,
+                                           const blDataIteratorType& fieldBeginIter)
+        {
+            // A field that doesn't start
+            // like a number is a NaN
+
+            auto firstCharacterIter = fieldBeginIter;
+
+            if(m_layout->m_hasQuotedFields && (*firstCharacterIter) == s_quoteToken)
+                ++firstCharacterIter;
+
+            bool isFieldANumber = (firstCharacterIter != m_endIter &&
+                                   s_digits.find(static_cast<char>(*firstCharacterIter)) != std::string::npos);
+
+            double number = 0;
+
+            auto fieldEndIter = convertFieldToNumber(fieldBeginIter,number);
+
+            if(isFieldANumber)
+                statistics[colIndex].addValue(number);
+            else
+                statistics[colIndex].addNaN();
+
+            return fieldEndIter;
+        };
+
+        std::ptrdiff_t numberOfRowsToVisit = std::max(std::min(numberOfRows,m_layout->m_rows - firstRowIndex),std::ptrdiff_t(0));
+
+        totalNumberOfFieldsVisited += forEachField(chunkBeginIter,
+                                                   chunkEndIter,
+                                                   firstRowIndex,
+                                                   numberOfRowsToVisit,
+                                                   addField);
+
+        std::lock_guard<std::mutex> lock(chunkStatisticsMutex);
+
+        chunkStatistics.push_back(std::make_pair(chunkIndex,std::move(statistics)));
+    };
+
+    forEachRowAlignedChunkInParallel(numberOfThreads,computeChunkStatistics);
+
+
+
+    std::sort(chunkStatistics.begin(),
+              chunkStatistics.end(),
+              [](const std::pair<std::size_t,std::vector<blColumnStatistics> >& a,
+                 const std::pair<std::size_t,std::vector<blColumnStatistics> >& b){return (a.first < b.first);});
+
+    for(const auto& statistics : chunkStatistics)
+    {
+        for(std::size_t i = 0; i < cols; ++i)
+            columnStatistics[i].merge(statistics.second[i]);
+    }
+
+
+
+    // In the ragged rows mode, the data
+    // points missing from a column are
+    // counted as NaNs
+
+    if(areRowFieldCountsBuilt())
+    {
+        std::size_t rows = static_cast<std::size_t>(m_layout->m_rows);
+
+        for(auto& statistics : columnStatistics)
+        {
+            while(statistics.getCount() + statistics.getNaNCount() < rows)
+                statistics.addNaN();
+        }
+    }
+
+
+
+    return totalNumberOfFieldsVisited;
 }
+//-------------------------------------------------------------------
 
 
 
+//-------------------------------------------------------------------
+// Function used to filter the data rows while scanning the
+// csv data, converting only the fields of the key columns
+//-------------------------------------------------------------------
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
+
+template<typename blRowPredicateType>
 
-inline blCSVMatrixIterator<const blDataIteratorType,blNumberType> blCSVMatrixIterator<blDataIteratorType,blNumberType>::cbegin()const
+inline std::size_t blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::selectRows(const std::vector<std::ptrdiff_t>& keyColIndexes,
+                                                                                   const blRowPredicateType& rowPredicate,
+                                                                                   std::vector<std::ptrdiff_t>& selectedRowIndexes,
+                                                                                   const std::size_t& numberOfThreads)const
 {
-    auto copiedSmartIterator = (*this);
+    selectedRowIndexes.clear();
 
-    copiedSmartIterator.moveToTheBeginning();
+    std::ptrdiff_t numberOfKeys = static_cast<std::ptrdiff_t>(keyColIndexes.size());
 
-    return copiedSmartIterator;
+    if(numberOfKeys == 0 || m_layout->m_size == 0)
+        return 0;
+
+
+
+    // The key columns are visited in the
+    // order they appear in the csv data,
+    // each passing its position among the
+    // key columns to the functor
+
+    std::vector< std::pair<std::ptrdiff_t,std::ptrdiff_t> > keyColsInDataOrder;
+
+    for(std::ptrdiff_t i = 0; i < numberOfKeys; ++i)
+    {
+        if(keyColIndexes[i] < 0 || keyColIndexes[i] >= m_layout->m_cols)
+            return 0;
+
+        keyColsInDataOrder.push_back(std::make_pair(getColIndexInData(keyColIndexes[i]),i));
+    }
+
+    std::sort(keyColsInDataOrder.begin(),keyColsInDataOrder.end());
+
+    for(std::size_t i = 1; i < keyColsInDataOrder.size(); ++i)
+    {
+        if(keyColsInDataOrder[i].first == keyColsInDataOrder[i - 1].first)
+            return 0;
+    }
+
+
+
+    // Each chunk selects its own rows,
+    // which are then concatenated in the
+    // order of the chunks
+
+    std::vector< std::pair<std::size_t,std::vector<std::ptrdiff_t> > > chunkSelections;
+    std::mutex chunkSelectionsMutex;
+
+    bool areRowsRagged = areRowFieldCountsBuilt();
+
+
+
+    auto selectChunkRows = [this,&numberOfKeys,&keyColsInDataOrder,&rowPredicate,&chunkSelections,&chunkSelectionsMutex,&areRowsRagged](const std::size_t& chunkIndex,
+                                                                                                                                         const blDataIteratorType& chunkBeginIter,
+                                                                                                                                         const blDataIteratorType& chunkEndIter,
+                                                                                                                                         const std::ptrdiff_t& firstRowIndex,
+                                                                                                                                         const std::ptrdiff_t& numberOfRows)
+    {
+        std::vector<std::ptrdiff_t> selection;
+
+        std::vector<blNumberType> keyValues(numberOfKeys,m_missingValue);
+
+        std::ptrdiff_t currentRowIndex = firstRowIndex;
+        std::ptrdiff_t numberOfKeysConverted = 0;
+
+
+
+        // A row is judged once the next
+        // row is reached, a row missing
+        // some of its key fields is only
+        // judged in the ragged rows mode
+        // (with the missing value for them)
+
+        auto judgeRowsBefore = [this,&rowPredicate,&selection,&keyValues,&currentRowIndex,&numberOfKeysConverted,&numberOfKeys,&areRowsRagged](const std::ptrdiff_t& rowIndex)
+        {
+            for(; currentRowIndex < rowIndex; ++currentRowIndex)
+            {
+                const std::vector<blNumberType>& rowKeyValues = keyValues;
+
+                if((areRowsRagged || numberOfKeysConverted == numberOfKeys) && rowPredicate(rowKeyValues))
+                    selection.push_back(currentRowIndex);
+
+                std::fill(keyValues.begin(),keyValues.end(),m_missingValue);
+
+                numberOfKeysConverted = 0;
+            }
+        };
+
+        auto convertKeyField = [this,&keyValues,&numberOfKeysConverted,&judgeRowsBefore](const std::ptrdiff_t& rowIndex,
+                                                                                         const std::ptrdiff_t& keyIndex,
+                                                                                         const blDataIteratorType& fieldBeginIter)
+        {
+            judgeRowsBefore(rowIndex);
+
+            keyValues[keyIndex] = blNumberType(0);
+
+            ++numberOfKeysConverted;
+
+            return convertFieldToNumber(fieldBeginIter,keyValues[keyIndex]);
+        };
+
+        std::ptrdiff_t numberOfRowsToVisit = std::max(std::min(numberOfRows,m_layout->m_rows - firstRowIndex),std::ptrdiff_t(0));
+
+        forEachFieldOfColumns(chunkBeginIter,
+                              chunkEndIter,
+                              firstRowIndex,
+                              numberOfRowsToVisit,
+                              keyColsInDataOrder,
+                              convertKeyField);
+
+        judgeRowsBefore(firstRowIndex + numberOfRowsToVisit);
+
+        std::lock_guard<std::mutex> lock(chunkSelectionsMutex);
+
+        chunkSelections.push_back(std::make_pair(chunkIndex,std::move(selection)));
+    };
+
+    forEachRowAlignedChunkInParallel(numberOfThreads,selectChunkRows);
+
+
+
+    std::sort(chunkSelections.begin(),
+              chunkSelections.end(),
+              [](const std::pair<std::size_t,std::vector<std::ptrdiff_t> >& a,
+                 const std::pair<std::size_t,std::vector<std::ptrdiff_t> >& b){return (a.first < b.first);});
+
+    for(const auto& selection : chunkSelections)
+        selectedRowIndexes.insert(selectedRowIndexes.end(),selection.second.begin(),selection.second.end());
+
+    return selectedRowIndexes.size();
 }
+//-------------------------------------------------------------------
 
 
 
+//-------------------------------------------------------------------
+// Function used to parse only the specified data rows
+// into a filtered matrix
+//-------------------------------------------------------------------
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
+
+template<typename blAllocatorType>
 
-inline blCSVMatrixIterator<const blDataIteratorType,blNumberType> blCSVMatrixIterator<blDataIteratorType,blNumberType>::cend()const
+inline std::size_t blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::materializeRows(const std::vector<std::ptrdiff_t>& rowIndexes,
+                                                                                        std::vector<blNumberType,blAllocatorType>& matrix,
+                                                                                        const blAdvancingIteratorMethod& outputLayout)const
 {
-    auto copiedSmartIterator = (*this);
+    std::ptrdiff_t cols = m_layout->m_cols;
+    std::ptrdiff_t numberOfRowsToParse = static_cast<std::ptrdiff_t>(rowIndexes.size());
 
-    copiedSmartIterator.moveToTheEnd();
+    matrix.assign(static_cast<std::size_t>(numberOfRowsToParse * cols),blNumberType(0));
 
-    return copiedSmartIterator;
+    bool isOutputColMajor = (outputLayout == COL_MAJOR ||
+                             outputLayout == COL_PAGE_MAJOR);
+
+    std::size_t numberOfDataPointsParsed = 0;
+
+
+
+    // Without a row index we keep track
+    // of the last row found, so that
+    // increasing row indexes are found
+    // in one forward scan
+
+    auto rowBeginIter = m_firstDataPointIter;
+    std::ptrdiff_t rowBeginIndex = 0;
+
+    for(std::ptrdiff_t i = 0; i < numberOfRowsToParse; ++i)
+    {
+        std::ptrdiff_t rowIndex = rowIndexes[i];
+
+        if(rowIndex < 0 || rowIndex >= m_layout->m_rows)
+            continue;
+
+        if(isRowIndexBuilt())
+        {
+            rowBeginIter = m_beginIter;
+            std::advance(rowBeginIter,m_layout->m_rowOffsets[rowIndex]);
+        }
+        else
+        {
+            if(rowIndex < rowBeginIndex)
+            {
+                rowBeginIter = m_firstDataPointIter;
+                rowBeginIndex = 0;
+            }
+
+            auto startingIter = rowBeginIter;
+
+            if(findBeginningOfNthField(startingIter,
+                                       m_endIter,
+                                       m_layout->m_rowTokenScanner,
+                                       rowIndex - rowBeginIndex,
+                                       rowBeginIter) != rowIndex - rowBeginIndex)
+            {
+                break;
+            }
+
+            rowBeginIndex = rowIndex;
+        }
+
+
+
+        auto write = [&matrix,&cols,&numberOfRowsToParse,&isOutputColMajor,&i](const std::size_t& dataIndex,const blNumberType& number)
+        {
+            std::ptrdiff_t colIndex = static_cast<std::ptrdiff_t>(dataIndex) % cols;
+
+            if(isOutputColMajor)
+                matrix[colIndex * numberOfRowsToParse + i] = number;
+            else
+                matrix[i * cols + colIndex] = number;
+        };
+
+        numberOfDataPointsParsed += parseDataPoints(rowBeginIter,m_endIter,rowIndex,1,write);
+    }
+
+    return numberOfDataPointsParsed;
 }
 //-------------------------------------------------------------------
 
 
 
 //-------------------------------------------------------------------
-// Function used to convert the text we're currently
-// pointing to into a number, this function is called
-// internally everytime the iterator is moved to a different
-// location in the text
+// Functions used to get a view of a data row
 //-------------------------------------------------------------------
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline blCSVRowView<blDataIteratorType,blNumberType,blNumberConverterType> blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::row(const std::ptrdiff_t& rowIndex)const
+{
+    blCSVRowView<blDataIteratorType,blNumberType,blNumberConverterType> rowView;
+
+    row(rowIndex,rowView);
+
+    return rowView;
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline void blCSVMatrixIterator<blDataIteratorType,blNumberType>::convertToNumberFromCurrentPosition()
+inline bool blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::row(const std::ptrdiff_t& rowIndex,
+                                                                                            blCSVRowView<blDataIteratorType,blNumberType,blNumberConverterType>& rowView)const
 {
-    blAlgorithmsLIB::convertToNumber(m_iter,m_endIter,'.',m_number,0);
+    rowView.m_layout = m_layout;
+    rowView.m_numberConverter = m_numberConverter;
+    rowView.m_missingValue = m_missingValue;
+    rowView.m_rowIndex = -1;
+    rowView.m_rowBeginIter = m_endIter;
+    rowView.m_rowEndIter = m_endIter;
+    rowView.m_fieldBeginOffsets.clear();
+    rowView.m_fieldEndOffsets.clear();
+
+    if(rowIndex < 0 || rowIndex >= m_layout->m_rows)
+        return false;
+
+
+
+    // First we find the
+    // beginning of the row
+
+    auto rowBeginIter = m_firstDataPointIter;
+
+    if(isRowIndexBuilt())
+    {
+        rowBeginIter = m_beginIter;
+        std::advance(rowBeginIter,m_layout->m_rowOffsets[rowIndex]);
+    }
+    else
+    {
+        std::ptrdiff_t rowBeginDataIndex = rowIndex * m_layout->m_colsInData;
+
+        auto startingIter = m_firstDataPointIter;
+        std::ptrdiff_t startingDataIndex = 0;
+
+        if(areDataPointCheckpointsBuilt())
+        {
+            std::ptrdiff_t checkpointIndex = std::min(rowBeginDataIndex / m_layout->m_dataPointCheckpointInterval,
+                                                      static_cast<std::ptrdiff_t>(m_layout->m_dataPointCheckpointOffsets.size()) - 1);
+
+            startingIter = m_beginIter;
+            std::advance(startingIter,m_layout->m_dataPointCheckpointOffsets[checkpointIndex]);
+            startingDataIndex = checkpointIndex * m_layout->m_dataPointCheckpointInterval;
+        }
+
+        std::ptrdiff_t movement = rowBeginDataIndex - startingDataIndex;
+
+        if(findBeginningOfNthField(startingIter,
+                                   m_endIter,
+                                   m_layout->m_rowAndColTokenScanner,
+                                   movement,
+                                   rowBeginIter) < movement)
+        {
+            return false;
+        }
+    }
+
+
+
+    // Then we record where each field
+    // of the row begins and ends (in the
+    // ragged rows mode the row has its
+    // own number of fields)
+
+    std::ptrdiff_t numberOfFieldsInRow = m_layout->m_colsInData;
+
+    if(areRowFieldCountsBuilt())
+        numberOfFieldsInRow = m_layout->m_rowFieldCounts[rowIndex];
+
+    rowView.m_fieldBeginOffsets.reserve(static_cast<std::size_t>(std::max(numberOfFieldsInRow,std::ptrdiff_t(0))));
+    rowView.m_fieldEndOffsets.reserve(static_cast<std::size_t>(std::max(numberOfFieldsInRow,std::ptrdiff_t(0))));
+
+    auto currentIter = rowBeginIter;
+    auto fieldBeginIter = rowBeginIter;
+    auto fieldEndIter = rowBeginIter;
+
+    for(std::ptrdiff_t fieldIndex = 0; fieldIndex < numberOfFieldsInRow; ++fieldIndex)
+    {
+        if(findBeginAndEndOfNthField(currentIter,
+                                     m_endIter,
+                                     m_layout->m_rowAndColTokensCombined,
+                                     std::ptrdiff_t(0),
+                                     fieldBeginIter,
+                                     fieldEndIter) < 0)
+        {
+            break;
+        }
+
+        rowView.m_fieldBeginOffsets.push_back(std::distance(rowBeginIter,fieldBeginIter));
+        rowView.m_fieldEndOffsets.push_back(std::distance(rowBeginIter,fieldEndIter));
+
+        currentIter = fieldEndIter;
+    }
+
+
+
+    rowView.m_rowIndex = rowIndex;
+    rowView.m_rowBeginIter = rowBeginIter;
+    rowView.m_rowEndIter = (rowView.m_fieldEndOffsets.empty() ? rowBeginIter : fieldEndIter);
+
+    return true;
 }
 //-------------------------------------------------------------------
 
@@ -1266,9 +6058,10 @@ inline void blCSVMatrixIterator<blDataIteratorType,blNumberType>::convertToNumbe
 // Arithmetic operators
 //-------------------------------------------------------------------
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline blCSVMatrixIterator<blDataIteratorType,blNumberType>& blCSVMatrixIterator<blDataIteratorType,blNumberType>::operator+=(const std::ptrdiff_t& movement)
+inline blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>& blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::operator+=(const std::ptrdiff_t& movement)
 {
     moveIterator(movement,m_advancingIteratorMethod);
     return (*this);
@@ -1277,9 +6070,10 @@ inline blCSVMatrixIterator<blDataIteratorType,blNumberType>& blCSVMatrixIterator
 
 
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline blCSVMatrixIterator<blDataIteratorType,blNumberType>& blCSVMatrixIterator<blDataIteratorType,blNumberType>::operator-=(const std::ptrdiff_t& movement)
+inline blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>& blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::operator-=(const std::ptrdiff_t& movement)
 {
     moveIterator(-movement,m_advancingIteratorMethod);
     return (*this);
@@ -1288,9 +6082,10 @@ inline blCSVMatrixIterator<blDataIteratorType,blNumberType>& blCSVMatrixIterator
 
 
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline blCSVMatrixIterator<blDataIteratorType,blNumberType>& blCSVMatrixIterator<blDataIteratorType,blNumberType>::operator++()
+inline blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>& blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::operator++()
 {
     moveIterator(1,m_advancingIteratorMethod);
     return (*this);
@@ -1299,9 +6094,10 @@ inline blCSVMatrixIterator<blDataIteratorType,blNumberType>& blCSVMatrixIterator
 
 
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline blCSVMatrixIterator<blDataIteratorType,blNumberType>& blCSVMatrixIterator<blDataIteratorType,blNumberType>::operator--()
+inline blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>& blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::operator--()
 {
     moveIterator(-1,m_advancingIteratorMethod);
     return (*this);
@@ -1310,9 +6106,10 @@ inline blCSVMatrixIterator<blDataIteratorType,blNumberType>& blCSVMatrixIterator
 
 
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline blCSVMatrixIterator<blDataIteratorType,blNumberType> blCSVMatrixIterator<blDataIteratorType,blNumberType>::operator++(int)
+inline blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType> blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::operator++(int)
 {
     auto temp(*this);
     moveIterator(1,m_advancingIteratorMethod);
@@ -1322,9 +6119,10 @@ inline blCSVMatrixIterator<blDataIteratorType,blNumberType> blCSVMatrixIterator<
 
 
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline blCSVMatrixIterator<blDataIteratorType,blNumberType> blCSVMatrixIterator<blDataIteratorType,blNumberType>::operator--(int)
+inline blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType> blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::operator--(int)
 {
     auto temp(*this);
     moveIterator(-1,m_advancingIteratorMethod);
@@ -1334,9 +6132,10 @@ inline blCSVMatrixIterator<blDataIteratorType,blNumberType> blCSVMatrixIterator<
 
 
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline blCSVMatrixIterator<blDataIteratorType,blNumberType> blCSVMatrixIterator<blDataIteratorType,blNumberType>::operator+(const std::ptrdiff_t& movement)const
+inline blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType> blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::operator+(const std::ptrdiff_t& movement)const
 {
     auto temp(*this);
     temp += movement;
@@ -1346,9 +6145,10 @@ inline blCSVMatrixIterator<blDataIteratorType,blNumberType> blCSVMatrixIterator<
 
 
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline blCSVMatrixIterator<blDataIteratorType,blNumberType> blCSVMatrixIterator<blDataIteratorType,blNumberType>::operator-(const std::ptrdiff_t& movement)const
+inline blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType> blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::operator-(const std::ptrdiff_t& movement)const
 {
     auto temp(*this);
     temp -= movement;
@@ -1363,9 +6163,10 @@ inline blCSVMatrixIterator<blDataIteratorType,blNumberType> blCSVMatrixIterator<
 // (it returns the distance between the iterators)
 //-------------------------------------------------------------------
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline std::ptrdiff_t blCSVMatrixIterator<blDataIteratorType,blNumberType>::operator-(const blCSVMatrixIterator<blDataIteratorType,blNumberType>& csvMatrixIterator)const
+inline std::ptrdiff_t blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::operator-(const blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>& csvMatrixIterator)const
 {
     return (m_iter - csvMatrixIterator.getIter());
 }
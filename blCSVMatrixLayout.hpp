@@ -0,0 +1,259 @@
+#ifndef BL_CSVMATRIXLAYOUT_HPP
+#define BL_CSVMATRIXLAYOUT_HPP
+
+
+
+//-------------------------------------------------------------------
+// FILE:            blCSVMatrixLayout.hpp
+// CLASS:           blCSVMatrixLayout
+//                  blCSVRowCursors
+// BASE CLASS:      None
+//
+//
+//
+// PURPOSE:         Classes holding what a blCSVMatrixIterator knows about
+//                  the layout of its csv data, so that it can be shared
+//                  between copies of the iterator
+//
+//                  -- blCSVMatrixLayout holds the row/column tokens, the
+//                     comment prefixes and number of header rows, the
+//                     dimensions, the column names, the column projection
+//                     and the optional row index and data point checkpoints
+//
+//                     -- Iterators share the layout through a reference
+//                        counted pointer, so copying an iterator only copies
+//                        a few words and never allocates
+//
+//                     -- A shared layout is never changed, an iterator that
+//                        needs to change it first makes its own copy
+//
+//                  -- blCSVRowCursors holds the cursors (one per row) used
+//                     when advancing an iterator in a column-major way
+//
+//                     -- The cursors belong to one iterator, copies don't get
+//                        them and only build their own once they keep moving
+//                        in a column-major way, so copying an iterator (or
+//                        making a temporary with it + n) never copies them
+//
+//                  -- All offsets are counted from the begin iterator of
+//                     the csv data, so the layout stays valid when the
+//                     data is moved to another buffer
+//
+//                  -- These classes are defined within the
+//                     "blAlgorithmsLIB" namespace
+//
+//
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+//
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Includes needed for this file
+//-------------------------------------------------------------------
+#include <string>
+#include <vector>
+#include <cstddef>
+
+#include "blTokenSet.hpp"
+#include "blSIMDTokenScanner.hpp"
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// NOTE: This class is defined within the blAlgorithmsLIB namespace
+//-------------------------------------------------------------------
+namespace blAlgorithmsLIB
+{
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+class blCSVMatrixLayout
+{
+public: // Constructors and destructor
+
+
+
+    // Default constructor
+
+    blCSVMatrixLayout()
+    {
+        m_hasQuotedFields = false;
+        m_numberOfHeaderRows = -1;
+        m_rows = 0;
+        m_cols = 0;
+        m_colsInData = 0;
+        m_size = 0;
+        m_shouldRowIndexBeBuilt = false;
+        m_shouldRaggedRowsBeHandled = false;
+        m_dataPointCheckpointInterval = 0;
+        m_lastRowBeginOffset = -1;
+    }
+
+
+
+public: // Public variables
+
+
+
+    // Row and Column Tokens
+    // used to parse the csv data
+
+    std::string                                                         m_rowTokens;
+    std::string                                                         m_colTokens;
+    std::string                                                         m_rowAndColTokensCombined;
+
+
+
+    // Membership table of the row and
+    // column tokens combined, so that the
+    // iterator doesn't search the tokens
+    // for every byte it skips
+
+    blTokenSet                                                          m_rowAndColTokenSet;
+
+
+
+    // Scanners of the row, column and
+    // combined tokens and of the quote
+    // token, built once here instead of
+    // on every scan of the data
+
+    blSIMDTokenScanner                                                  m_rowTokenScanner;
+    blSIMDTokenScanner                                                  m_colTokenScanner;
+    blSIMDTokenScanner                                                  m_rowAndColTokenScanner;
+    blSIMDTokenScanner                                                  m_quoteTokenScanner;
+
+
+
+    // Flag telling us whether the
+    // csv data contains any quotes
+
+    bool                                                                m_hasQuotedFields;
+
+
+
+    // Prefixes of the comment lines
+    // and number of header rows found
+    // before the first data row (-1
+    // when the title row is detected)
+
+    std::vector<std::string>                                            m_commentPrefixes;
+    std::ptrdiff_t                                                      m_numberOfHeaderRows;
+
+
+
+    // Number of rows/columns
+    // and total number of
+    // data points exposed by
+    // the iterator
+
+    std::ptrdiff_t                                                      m_rows;
+    std::ptrdiff_t                                                      m_cols;
+    std::size_t                                                         m_size;
+
+
+
+    // Number of columns in
+    // the csv data (different
+    // from the above when the
+    // columns are projected)
+
+    std::ptrdiff_t                                                      m_colsInData;
+
+
+
+    // Index (in the csv data) of
+    // each column exposed by the
+    // iterator, empty when all the
+    // columns are exposed
+
+    std::vector<std::ptrdiff_t>                                         m_projectedColIndexes;
+
+
+
+    // Names of the columns
+    // taken from the title
+    // row if there is one,
+    // both the exposed ones
+    // and all of them
+
+    std::vector<std::string>                                            m_columnNames;
+    std::vector<std::string>                                            m_columnNamesInData;
+
+
+
+    // Row index (offset of the
+    // beginning of each data row)
+
+    bool                                                                m_shouldRowIndexBeBuilt;
+    std::vector<std::ptrdiff_t>                                         m_rowOffsets;
+
+
+
+    // Number of fields of each data
+    // row, recorded when the rows are
+    // allowed to be ragged (to have
+    // different numbers of fields)
+
+    bool                                                                m_shouldRaggedRowsBeHandled;
+    std::vector<std::ptrdiff_t>                                         m_rowFieldCounts;
+
+
+
+    // Data point checkpoints (offset
+    // of every Kth data point)
+
+    std::ptrdiff_t                                                      m_dataPointCheckpointInterval;
+    std::vector<std::ptrdiff_t>                                         m_dataPointCheckpointOffsets;
+
+
+
+    // Offset of the beginning of the
+    // last data row, from where
+    // appended data is scanned
+    // (-1 when not known yet)
+
+    std::ptrdiff_t                                                      m_lastRowBeginOffset;
+};
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+class blCSVRowCursors
+{
+public: // Public variables
+
+
+
+    // Offset and column index of the
+    // last visited data point of
+    // each row
+
+    std::vector<std::ptrdiff_t>                                         m_offsets;
+    std::vector<std::ptrdiff_t>                                         m_colIndexes;
+};
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// End of namespace
+}
+//-------------------------------------------------------------------
+
+
+
+#endif // BL_CSVMATRIXLAYOUT_HPP
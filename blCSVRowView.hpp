@@ -0,0 +1,518 @@
+#ifndef BL_CSVROWVIEW_HPP
+#define BL_CSVROWVIEW_HPP
+
+
+
+//-------------------------------------------------------------------
+// FILE:            blCSVRowView.hpp
+// CLASS:           blCSVRowView
+// BASE CLASS:      None
+//
+//
+//
+// PURPOSE:         A lightweight view of one data row of the csv data
+//                  of a blCSVMatrixIterator, handed out by the iterator's
+//                  row functions
+//
+//                  -- The view holds the byte range of the row and the
+//                     offsets of the beginning and end of each of its
+//                     fields (in the order they appear in the csv data),
+//                     so it never copies the csv data
+//
+//                  -- The fields are only converted into numbers when
+//                     they are accessed, by a copy of the iterator's number
+//                     converter, and the view shares the iterator's layout
+//                     (so quoted fields, projected columns and ragged rows
+//                     behave the same as when moving the iterator), so
+//                     reading a row is a plain loop over its columns
+//                     instead of moving the iterator to each data point
+//
+//                     NOTE:  A view doesn't point to the iterator that
+//                            handed it out, so it stays valid after that
+//                            iterator is moved or destroyed (for ex. with
+//                            (it + 5).row(3)), but it can only be used as
+//                            long as the csv data is alive and unchanged
+//
+//                  -- A field missing from a ragged row (or a column out
+//                     of range) reads as the iterator's missing value
+//
+//                  -- This class is defined within the
+//                     "blAlgorithmsLIB" namespace
+//
+//
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+//
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Includes needed for this file
+//-------------------------------------------------------------------
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <algorithm>
+
+#include "blConvertToNumber.hpp"
+#include "blCSVMatrixLayout.hpp"
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// NOTE: This class is defined within the blAlgorithmsLIB namespace
+//-------------------------------------------------------------------
+namespace blAlgorithmsLIB
+{
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Forward declaration of the iterator
+// handing out the row views
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+class blCSVMatrixIterator;
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType = blDefaultNumberConverter>
+
+class blCSVRowView
+{
+public: // Friend classes
+
+
+
+    // The iterator fills in
+    // the views it hands out
+    // (and unquotes their fields)
+
+    friend class blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>;
+
+
+
+public: // Constructors and destructor
+
+
+
+    // Default constructor (an
+    // empty view of no row)
+
+    blCSVRowView()
+    {
+        m_missingValue = blNumberType(0);
+        m_rowIndex = -1;
+    }
+
+
+
+public: // Public functions
+
+
+
+    // Function used to know whether
+    // the view points to a data row
+
+    bool                                                                isValid()const;
+
+
+
+    // Functions used to get the row's
+    // index and its number of (projected)
+    // columns
+
+    const std::ptrdiff_t&                                               rowIndex()const;
+    std::ptrdiff_t                                                      size()const;
+
+
+
+    // Functions used to get the byte range
+    // of the row (from the beginning of its
+    // first field to the end of its last
+    // one) and the offsets of the beginning
+    // and end of each of its fields, counted
+    // from the beginning of the row
+
+    const blDataIteratorType&                                           getRowBeginIter()const;
+    const blDataIteratorType&                                           getRowEndIter()const;
+
+    const std::vector<std::ptrdiff_t>&                                  getFieldBeginOffsets()const;
+    const std::vector<std::ptrdiff_t>&                                  getFieldEndOffsets()const;
+
+
+
+    // Functions used to convert the
+    // field of a (projected) column
+    // into a number
+
+    blNumberType                                                        operator[](const std::ptrdiff_t& colIndex)const;
+    blNumberType                                                        at(const std::ptrdiff_t& colIndex)const;
+
+
+
+    // Function used to know whether the
+    // row has no field for a column
+
+    bool                                                                isFieldMissing(const std::ptrdiff_t& colIndex)const;
+
+
+
+    // Function used to get the text of the
+    // field of a column (unquoted)
+
+    std::string                                                         getField(const std::ptrdiff_t& colIndex)const;
+
+
+
+    // Function used to convert every
+    // (projected) column of the row into
+    // the output iterator, it returns the
+    // number of values written
+
+    template<typename blOutputIteratorType>
+    std::size_t                                                         fill(blOutputIteratorType outputIter)const;
+
+
+
+protected: // Protected functions
+
+
+
+    // Function used to get the index of
+    // the field of a column in the row
+    // (-1 when the row has no such field)
+
+    std::ptrdiff_t                                                      getFieldIndex(const std::ptrdiff_t& colIndex)const;
+
+
+
+protected: // Protected variables
+
+
+
+    // The layout of the csv data (shared
+    // with the iterator that handed out
+    // this view, a shared layout is never
+    // changed), the converter used for the
+    // fields and the missing value
+
+    std::shared_ptr<const blCSVMatrixLayout>                            m_layout;
+    blNumberConverterType                                               m_numberConverter;
+    blNumberType                                                        m_missingValue;
+
+
+
+    // Index of the row
+
+    std::ptrdiff_t                                                      m_rowIndex;
+
+
+
+    // Byte range of the row
+
+    blDataIteratorType                                                  m_rowBeginIter;
+    blDataIteratorType                                                  m_rowEndIter;
+
+
+
+    // Offsets of the beginning and
+    // end of each field of the row
+
+    std::vector<std::ptrdiff_t>                                         m_fieldBeginOffsets;
+    std::vector<std::ptrdiff_t>                                         m_fieldEndOffsets;
+};
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline bool blCSVRowView<blDataIteratorType,blNumberType,blNumberConverterType>::isValid()const
+{
+    return (m_layout && m_rowIndex >= 0);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline const std::ptrdiff_t& blCSVRowView<blDataIteratorType,blNumberType,blNumberConverterType>::rowIndex()const
+{
+    return m_rowIndex;
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline std::ptrdiff_t blCSVRowView<blDataIteratorType,blNumberType,blNumberConverterType>::size()const
+{
+    if(!isValid())
+        return 0;
+
+    return m_layout->m_cols;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline const blDataIteratorType& blCSVRowView<blDataIteratorType,blNumberType,blNumberConverterType>::getRowBeginIter()const
+{
+    return m_rowBeginIter;
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline const blDataIteratorType& blCSVRowView<blDataIteratorType,blNumberType,blNumberConverterType>::getRowEndIter()const
+{
+    return m_rowEndIter;
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline const std::vector<std::ptrdiff_t>& blCSVRowView<blDataIteratorType,blNumberType,blNumberConverterType>::getFieldBeginOffsets()const
+{
+    return m_fieldBeginOffsets;
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline const std::vector<std::ptrdiff_t>& blCSVRowView<blDataIteratorType,blNumberType,blNumberConverterType>::getFieldEndOffsets()const
+{
+    return m_fieldEndOffsets;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline blNumberType blCSVRowView<blDataIteratorType,blNumberType,blNumberConverterType>::operator[](const std::ptrdiff_t& colIndex)const
+{
+    return at(colIndex);
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline blNumberType blCSVRowView<blDataIteratorType,blNumberType,blNumberConverterType>::at(const std::ptrdiff_t& colIndex)const
+{
+    std::ptrdiff_t fieldIndex = getFieldIndex(colIndex);
+
+    if(fieldIndex < 0)
+        return m_missingValue;
+
+
+
+    // A non-valid number is
+    // interpreted as zero
+
+    blNumberType number = blNumberType(0);
+
+    auto fieldBeginIter = m_rowBeginIter;
+    std::advance(fieldBeginIter,m_fieldBeginOffsets[fieldIndex]);
+
+    auto fieldEndIter = m_rowBeginIter;
+    std::advance(fieldEndIter,m_fieldEndOffsets[fieldIndex]);
+
+    if(!m_layout->m_hasQuotedFields ||
+       fieldBeginIter == fieldEndIter ||
+       (*fieldBeginIter) != '"')
+    {
+        m_numberConverter(fieldBeginIter,fieldEndIter,number);
+        return number;
+    }
+
+
+
+    // The field is quoted, so we unquote
+    // it and drop any column tokens in it
+    // before converting it
+
+    std::string fieldContents;
+
+    blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::copyQuotedField(fieldBeginIter,fieldEndIter,fieldContents);
+
+    fieldContents.erase(std::remove_if(fieldContents.begin(),
+                                       fieldContents.end(),
+                                       [this](const char& character){return (m_layout->m_colTokens.find(character) != std::string::npos);}),
+                        fieldContents.end());
+
+    m_numberConverter(fieldContents.cbegin(),fieldContents.cend(),number);
+
+    return number;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline bool blCSVRowView<blDataIteratorType,blNumberType,blNumberConverterType>::isFieldMissing(const std::ptrdiff_t& colIndex)const
+{
+    return (getFieldIndex(colIndex) < 0);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline std::string blCSVRowView<blDataIteratorType,blNumberType,blNumberConverterType>::getField(const std::ptrdiff_t& colIndex)const
+{
+    std::string fieldContents;
+
+    std::ptrdiff_t fieldIndex = getFieldIndex(colIndex);
+
+    if(fieldIndex < 0)
+        return fieldContents;
+
+
+
+    auto fieldBeginIter = m_rowBeginIter;
+    std::advance(fieldBeginIter,m_fieldBeginOffsets[fieldIndex]);
+
+    auto fieldEndIter = m_rowBeginIter;
+    std::advance(fieldEndIter,m_fieldEndOffsets[fieldIndex]);
+
+    if(m_layout->m_hasQuotedFields &&
+       fieldBeginIter != fieldEndIter &&
+       (*fieldBeginIter) == '"')
+    {
+        blCSVMatrixIterator<blDataIteratorType,blNumberType,blNumberConverterType>::copyQuotedField(fieldBeginIter,fieldEndIter,fieldContents);
+    }
+    else
+    {
+        fieldContents.assign(fieldBeginIter,fieldEndIter);
+    }
+
+    return fieldContents;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+template<typename blOutputIteratorType>
+
+inline std::size_t blCSVRowView<blDataIteratorType,blNumberType,blNumberConverterType>::fill(blOutputIteratorType outputIter)const
+{
+    std::ptrdiff_t cols = size();
+
+    for(std::ptrdiff_t colIndex = 0; colIndex < cols; ++colIndex)
+    {
+        (*outputIter) = at(colIndex);
+        ++outputIter;
+    }
+
+    return static_cast<std::size_t>(cols);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline std::ptrdiff_t blCSVRowView<blDataIteratorType,blNumberType,blNumberConverterType>::getFieldIndex(const std::ptrdiff_t& colIndex)const
+{
+    if(!isValid() ||
+       colIndex < 0 ||
+       colIndex >= m_layout->m_cols)
+    {
+        return -1;
+    }
+
+
+
+    // Projected columns are counted
+    // in the csv data
+
+    std::ptrdiff_t fieldIndex = colIndex;
+
+    if(!m_layout->m_projectedColIndexes.empty())
+        fieldIndex = m_layout->m_projectedColIndexes[colIndex];
+
+    if(fieldIndex < 0 ||
+       fieldIndex >= static_cast<std::ptrdiff_t>(m_fieldBeginOffsets.size()))
+    {
+        return -1;
+    }
+
+    return fieldIndex;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// End of namespace
+}
+//-------------------------------------------------------------------
+
+
+
+#endif // BL_CSVROWVIEW_HPP
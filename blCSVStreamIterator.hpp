@@ -0,0 +1,1006 @@
+#ifndef BL_CSVSTREAMITERATOR_HPP
+#define BL_CSVSTREAMITERATOR_HPP
+
+
+
+//-------------------------------------------------------------------
+// FILE:            blCSVStreamIterator.hpp
+// CLASS:           blCSVStreamIterator
+// BASE CLASS:      None
+//
+//
+//
+// PURPOSE:         Forward-only iterator useful in streaming numbers
+//                  out of csv data in a single pass
+//
+//                  -- Unlike the blCSVMatrixIterator, this iterator does
+//                     not count the rows of the csv data when constructed,
+//                     it only looks at the title row (if there is one) and
+//                     at the first data row (to count the columns), so the
+//                     first value can be read right away
+//
+//                  -- Moving the iterator forward reads the next data point
+//                     directly from the current position, so every byte of
+//                     the csv data is scanned only once
+//
+//                  -- The number of rows is unknown (-1) until the iterator
+//                     reaches the end of the csv data, or until the user
+//                     explicitly asks for them to be counted
+//
+//                  -- The iterator keeps track of the actual row and column
+//                     of each data point, it does not assume that every row
+//                     has the same number of columns
+//
+//                  -- Empty rows and columns are skipped the same way as in
+//                     the blCSVMatrixIterator, and quoted fields (RFC 4180)
+//                     are supported
+//
+//                  -- This class and its functions are defined within
+//                     the "blAlgorithmsLIB" namespace
+//
+//
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+//
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Includes needed for this file
+//-------------------------------------------------------------------
+#include <iterator>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <algorithm>
+
+#include "blConvertToNumber.hpp"
+#include "blCountAndFind.hpp"
+#include "blTokenSet.hpp"
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// NOTE: This class is defined within the blAlgorithmsLIB namespace
+//-------------------------------------------------------------------
+namespace blAlgorithmsLIB
+{
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType>
+
+class blCSVStreamIterator
+{
+public: // Iterator traits
+
+
+
+    using iterator_category = std::input_iterator_tag;
+    using value_type = blNumberType;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const blNumberType*;
+    using reference = const blNumberType&;
+
+
+
+public: // Constructors and destructor
+
+
+
+    // No default constructor
+
+    blCSVStreamIterator() = delete;
+
+
+
+    // Constructor from two iterators
+    // and row and column tokens
+
+    blCSVStreamIterator(const blDataIteratorType& beginIter,
+                        const blDataIteratorType& endIter,
+                        const std::string rowTokens = ";\r\n",
+                        const std::string colTokens = " ,");
+
+
+
+    // Default copy constructor
+
+    blCSVStreamIterator(const blCSVStreamIterator<blDataIteratorType,blNumberType>& csvStreamIterator) = default;
+
+
+
+    // Destructor
+
+    ~blCSVStreamIterator()
+    {
+    }
+
+
+
+public: // Assignment operators
+
+
+
+    blCSVStreamIterator<blDataIteratorType,blNumberType>&               operator=(const blCSVStreamIterator<blDataIteratorType,blNumberType>& csvStreamIterator) = default;
+
+
+
+public: // Conversion operators
+
+
+
+    // Operator to convert this class to bool
+
+    operator bool()const
+    {
+        return (m_iter != m_endIter);
+    }
+
+
+
+public: // Comparison operators
+
+
+
+    bool                                                                operator==(const blCSVStreamIterator<blDataIteratorType,blNumberType>& csvStreamIterator)const;
+    bool                                                                operator!=(const blCSVStreamIterator<blDataIteratorType,blNumberType>& csvStreamIterator)const;
+
+
+
+public: // Reference and Dereference operators
+
+
+
+    const blNumberType*                                                 operator->()const;
+    const blNumberType&                                                 operator*()const;
+
+
+
+public: // Arithmetic operators
+
+
+
+    blCSVStreamIterator<blDataIteratorType,blNumberType>&               operator++();
+    blCSVStreamIterator<blDataIteratorType,blNumberType>                operator++(int);
+
+
+
+public: // Public functions
+
+
+
+    // Function used to manually set the data
+    // iterators and the row and column tokens
+    // The iterator is moved to the first
+    // data point
+
+    void                                                                setIterators(const blDataIteratorType& beginIter,
+                                                                                     const blDataIteratorType& endIter,
+                                                                                     const std::string& rowTokens,
+                                                                                     const std::string& colTokens);
+
+
+
+    // Function used to count the rows of
+    // the csv data when they are not known
+    // yet, by scanning the data from the
+    // current position to the end
+    // It returns the total number of rows
+
+    const std::ptrdiff_t&                                               countRows();
+
+
+
+    // Functions used to get this class' members
+
+    const blDataIteratorType&                                           getBeginIter()const;
+    const blDataIteratorType&                                           getEndIter()const;
+    const blDataIteratorType&                                           getIter()const;
+    const blNumberType&                                                 getNumber()const;
+
+    // NOTE:  The number of rows is -1
+    //        until it is known
+
+    const std::ptrdiff_t&                                               rows()const;
+    const std::ptrdiff_t&                                               cols()const;
+
+    const std::ptrdiff_t&                                               rowIndex()const;
+    const std::ptrdiff_t&                                               colIndex()const;
+    const std::ptrdiff_t&                                               dataIndex()const;
+
+    const std::string&                                                  rowTokens()const;
+    const std::string&                                                  colTokens()const;
+
+    const std::vector<std::string>&                                     getColumnNames()const;
+
+
+
+    // Functions use to get the begin/end iterators
+    // so that this iterator can be used in range
+    // based for loops and with stl algorithms
+
+    blCSVStreamIterator<blDataIteratorType,blNumberType>                begin()const;
+    blCSVStreamIterator<blDataIteratorType,blNumberType>                end()const;
+
+
+
+private: // Static functions/variables/constants
+
+
+
+    // Constant string used to find
+    // a "digit" or characters that
+    // would be used for digits
+
+    const static std::string                                            s_digits;
+
+
+
+    // The token used to quote fields
+
+    const static char                                                   s_quoteToken;
+
+
+
+protected: // Protected functions
+
+
+
+    // Function used to find the title
+    // row (if any) and the first data
+    // row, and to count the columns
+
+    void                                                                findTitleRowAndFirstDataRow();
+
+
+
+    // Function used to convert the data
+    // point at the current position and
+    // to find where it ends
+
+    void                                                                convertCurrentDataPoint();
+
+
+
+    // Function used to copy the contents
+    // of a quoted field, it returns the
+    // position right after the field's
+    // closing quote
+
+    blDataIteratorType                                                  copyQuotedField(const blDataIteratorType& fieldBeginIter,
+                                                                                        std::string& fieldContents)const;
+
+
+
+protected: // Protected variables
+
+
+
+    // Begin and end iterators
+    // used to know where the
+    // given buffer begins and
+    // ends
+
+    blDataIteratorType                                                  m_beginIter;
+    blDataIteratorType                                                  m_endIter;
+
+
+
+    // Iterators pointing to the
+    // beginning and end of the
+    // current data point
+
+    blDataIteratorType                                                  m_iter;
+    blDataIteratorType                                                  m_dataPointEndIter;
+
+
+
+    // The converted number
+
+    blNumberType                                                        m_number;
+
+
+
+    // Row/Column and data
+    // indexes of the current
+    // data point
+
+    std::ptrdiff_t                                                      m_rowIndex;
+    std::ptrdiff_t                                                      m_colIndex;
+    std::ptrdiff_t                                                      m_dataIndex;
+
+
+
+    // Number of rows (-1 until known)
+    // and number of columns (counted
+    // from the first data row)
+
+    std::ptrdiff_t                                                      m_rows;
+    std::ptrdiff_t                                                      m_cols;
+
+
+
+    // Row and column tokens, and sets
+    // used to quickly check whether a
+    // character is a token
+
+    std::string                                                         m_rowTokens;
+    std::string                                                         m_colTokens;
+
+    blTokenSet                                                          m_rowTokenSet;
+    blTokenSet                                                          m_colTokenSet;
+
+
+
+    // Names of the columns
+    // taken from the title
+    // row if there is one
+
+    std::vector<std::string>                                            m_columnNames;
+
+
+
+    // Buffer reused to unquote
+    // quoted data points
+
+    std::string                                                         m_quotedFieldContents;
+};
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Static constants definitions
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType>
+
+const std::string blCSVStreamIterator<blDataIteratorType,blNumberType>::s_digits = "-+.0123456789";
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType>
+
+const char blCSVStreamIterator<blDataIteratorType,blNumberType>::s_quoteToken = '"';
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Constructor
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType>
+
+inline blCSVStreamIterator<blDataIteratorType,blNumberType>::blCSVStreamIterator(const blDataIteratorType& beginIter,
+                                                                                 const blDataIteratorType& endIter,
+                                                                                 const std::string rowTokens,
+                                                                                 const std::string colTokens)
+{
+    setIterators(beginIter,
+                 endIter,
+                 rowTokens,
+                 colTokens);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Comparison operators
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType>
+
+inline bool blCSVStreamIterator<blDataIteratorType,blNumberType>::operator==(const blCSVStreamIterator<blDataIteratorType,blNumberType>& csvStreamIterator)const
+{
+    return (m_iter == csvStreamIterator.getIter());
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType>
+
+inline bool blCSVStreamIterator<blDataIteratorType,blNumberType>::operator!=(const blCSVStreamIterator<blDataIteratorType,blNumberType>& csvStreamIterator)const
+{
+    return (m_iter != csvStreamIterator.getIter());
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Reference and Dereference operators
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType>
+
+inline const blNumberType* blCSVStreamIterator<blDataIteratorType,blNumberType>::operator->()const
+{
+    return &m_number;
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType>
+
+inline const blNumberType& blCSVStreamIterator<blDataIteratorType,blNumberType>::operator*()const
+{
+    return m_number;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Arithmetic operators
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType>
+
+inline blCSVStreamIterator<blDataIteratorType,blNumberType>& blCSVStreamIterator<blDataIteratorType,blNumberType>::operator++()
+{
+    if(m_iter == m_endIter)
+        return (*this);
+
+
+
+    // We skip the tokens following the
+    // current data point, remembering
+    // whether any of them was a row
+    // token (meaning the next data
+    // point starts a new row)
+
+    bool hasRowTokenBeenFound = false;
+
+    auto currentIter = m_dataPointEndIter;
+
+    while(currentIter != m_endIter)
+    {
+        if(m_rowTokenSet.isToken(*currentIter))
+            hasRowTokenBeenFound = true;
+        else if(!m_colTokenSet.isToken(*currentIter))
+            break;
+
+        ++currentIter;
+    }
+
+    m_iter = currentIter;
+    ++m_dataIndex;
+
+
+
+    // If we reached the end, we
+    // now know the number of rows
+
+    if(m_iter == m_endIter)
+    {
+        ++m_rowIndex;
+        m_colIndex = 0;
+        m_rows = m_rowIndex;
+
+        return (*this);
+    }
+
+
+
+    if(hasRowTokenBeenFound)
+    {
+        ++m_rowIndex;
+        m_colIndex = 0;
+    }
+    else
+        ++m_colIndex;
+
+    convertCurrentDataPoint();
+
+    return (*this);
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType>
+
+inline blCSVStreamIterator<blDataIteratorType,blNumberType> blCSVStreamIterator<blDataIteratorType,blNumberType>::operator++(int)
+{
+    auto temp(*this);
+    ++(*this);
+    return temp;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to manually set the data iterators and
+// the token strings
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType>
+
+inline void blCSVStreamIterator<blDataIteratorType,blNumberType>::setIterators(const blDataIteratorType& beginIter,
+                                                                               const blDataIteratorType& endIter,
+                                                                               const std::string& rowTokens,
+                                                                               const std::string& colTokens)
+{
+    m_beginIter = beginIter;
+    m_endIter = endIter;
+    m_iter = m_beginIter;
+    m_dataPointEndIter = m_beginIter;
+
+
+
+    m_rowTokens = rowTokens;
+    m_colTokens = colTokens;
+
+    m_rowTokenSet = blTokenSet(m_rowTokens);
+    m_colTokenSet = blTokenSet(m_colTokens);
+
+
+
+    m_number = 0;
+    m_rowIndex = 0;
+    m_colIndex = 0;
+    m_dataIndex = 0;
+    m_rows = -1;
+    m_cols = 0;
+
+
+
+    findTitleRowAndFirstDataRow();
+
+    if(m_iter != m_endIter)
+        convertCurrentDataPoint();
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to find the title row and the first
+// data row of the csv data
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType>
+
+inline void blCSVStreamIterator<blDataIteratorType,blNumberType>::findTitleRowAndFirstDataRow()
+{
+    m_columnNames.clear();
+
+
+
+    // Here we attempt to find the
+    // first non-empty data row
+
+    auto rowBeginIter = m_beginIter;
+    auto rowEndIter = m_beginIter;
+
+    int rowIndex = findBeginAndEndOfNthDataPointRespectingQuotes(m_beginIter,
+                                                                 m_endIter,
+                                                                 m_rowTokens.begin(),
+                                                                 m_rowTokens.end(),
+                                                                 false,
+                                                                 s_quoteToken,
+                                                                 0,
+                                                                 rowBeginIter,
+                                                                 rowEndIter);
+
+    if(rowIndex < 0)
+    {
+        m_iter = m_endIter;
+        m_rows = 0;
+
+        return;
+    }
+
+
+
+    // If the row contains non-numeric
+    // characters, then it is the title
+    // row and we get the column names
+    // from it
+
+    blTokenSet purelyNumericalRowTokens(s_digits);
+    purelyNumericalRowTokens.addTokens(m_colTokens.begin(),m_colTokens.end());
+    purelyNumericalRowTokens.addToken(s_quoteToken);
+
+    auto firstNonNumericalIter = blAlgorithmsLIB::find_first_not_of(rowBeginIter,
+                                                                    rowEndIter,
+                                                                    purelyNumericalRowTokens,
+                                                                    0);
+
+    if(firstNonNumericalIter != rowEndIter)
+    {
+        auto addColumnName = [this](const blDataIteratorType& nameBeginIter,
+                                    const blDataIteratorType& nameEndIter)
+        {
+            if((*nameBeginIter) == s_quoteToken)
+            {
+                std::string columnName;
+                copyQuotedField(nameBeginIter,columnName);
+                m_columnNames.push_back(columnName);
+            }
+            else
+                m_columnNames.push_back(std::string(nameBeginIter,nameEndIter));
+
+            return true;
+        };
+
+        forEachDataPointRespectingQuotes(rowBeginIter,
+                                         rowEndIter,
+                                         m_colTokens.begin(),
+                                         m_colTokens.end(),
+                                         false,
+                                         s_quoteToken,
+                                         addColumnName);
+
+
+
+        // The first data row is
+        // the next non-empty row
+
+        auto titleRowBeginIter = rowBeginIter;
+
+        rowIndex = findBeginAndEndOfNthDataPointRespectingQuotes(titleRowBeginIter,
+                                                                 m_endIter,
+                                                                 m_rowTokens.begin(),
+                                                                 m_rowTokens.end(),
+                                                                 false,
+                                                                 s_quoteToken,
+                                                                 1,
+                                                                 rowBeginIter,
+                                                                 rowEndIter);
+
+        if(rowIndex != 1)
+        {
+            m_iter = m_endIter;
+            m_rows = 0;
+
+            return;
+        }
+    }
+
+
+
+    // We use the first data row
+    // to count the number of data
+    // columns
+
+    m_cols = countDataRowsRespectingQuotes(rowBeginIter,
+                                           rowEndIter,
+                                           m_colTokens.begin(),
+                                           m_colTokens.end(),
+                                           false,
+                                           s_quoteToken);
+
+    if(static_cast<std::ptrdiff_t>(m_columnNames.size()) > m_cols)
+        m_columnNames.resize(m_cols);
+
+
+
+    // Finally we point to the
+    // first data point, skipping
+    // any leading column tokens
+
+    m_iter = rowBeginIter;
+
+    while(m_iter != rowEndIter && m_colTokenSet.isToken(*m_iter))
+        ++m_iter;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to convert the current data point
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType>
+
+inline void blCSVStreamIterator<blDataIteratorType,blNumberType>::convertCurrentDataPoint()
+{
+    auto currentIter = m_iter;
+
+    m_number = blNumberType(0);
+
+    if((*m_iter) == s_quoteToken)
+    {
+        // The data point is quoted, so we
+        // unquote it and drop any column
+        // tokens in it (for ex. the thousands
+        // separator in "1,234.5") before
+        // converting it
+
+        m_quotedFieldContents.clear();
+
+        currentIter = copyQuotedField(m_iter,m_quotedFieldContents);
+
+        m_quotedFieldContents.erase(std::remove_if(m_quotedFieldContents.begin(),
+                                                   m_quotedFieldContents.end(),
+                                                   [this](const char& character){return m_colTokenSet.isToken(character);}),
+                                    m_quotedFieldContents.end());
+
+        blAlgorithmsLIB::convertToNumber(m_quotedFieldContents.cbegin(),m_quotedFieldContents.cend(),'.',m_number,0);
+    }
+    else
+    {
+        currentIter = blAlgorithmsLIB::convertToNumber(m_iter,m_endIter,'.',m_number,0);
+    }
+
+
+
+    // We then find the end of the data
+    // point, skipping anything left in
+    // it that is not a number
+
+    while(currentIter != m_endIter)
+    {
+        if(m_rowTokenSet.isToken(*currentIter) || m_colTokenSet.isToken(*currentIter))
+            break;
+
+        ++currentIter;
+    }
+
+    m_dataPointEndIter = currentIter;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to copy the contents of a quoted field
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType>
+
+inline blDataIteratorType blCSVStreamIterator<blDataIteratorType,blNumberType>::copyQuotedField(const blDataIteratorType& fieldBeginIter,
+                                                                                                std::string& fieldContents)const
+{
+    auto currentIter = fieldBeginIter;
+
+    // Skip the opening quote
+
+    if(currentIter != m_endIter)
+        ++currentIter;
+
+
+
+    while(currentIter != m_endIter)
+    {
+        if((*currentIter) == s_quoteToken)
+        {
+            ++currentIter;
+
+            // Two quotes in a row are
+            // an escaped quote, while a
+            // single one closes the field
+
+            if(currentIter != m_endIter && (*currentIter) == s_quoteToken)
+            {
+                fieldContents += s_quoteToken;
+                ++currentIter;
+            }
+            else
+                break;
+        }
+        else
+        {
+            fieldContents += static_cast<char>(*currentIter);
+            ++currentIter;
+        }
+    }
+
+
+
+    return currentIter;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to count the rows when they are not known
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType>
+
+inline const std::ptrdiff_t& blCSVStreamIterator<blDataIteratorType,blNumberType>::countRows()
+{
+    // The rows already visited plus the
+    // rows left from the current data
+    // point (which is outside of any
+    // quotes) to the end
+
+    if(m_rows < 0)
+    {
+        m_rows = m_rowIndex + countDataRowsRespectingQuotes(m_iter,
+                                                            m_endIter,
+                                                            m_rowTokens.begin(),
+                                                            m_rowTokens.end(),
+                                                            false,
+                                                            s_quoteToken);
+    }
+
+    return m_rows;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used to get the class' members
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType>
+
+inline const blDataIteratorType& blCSVStreamIterator<blDataIteratorType,blNumberType>::getBeginIter()const
+{
+    return m_beginIter;
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType>
+
+inline const blDataIteratorType& blCSVStreamIterator<blDataIteratorType,blNumberType>::getEndIter()const
+{
+    return m_endIter;
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType>
+
+inline const blDataIteratorType& blCSVStreamIterator<blDataIteratorType,blNumberType>::getIter()const
+{
+    return m_iter;
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType>
+
+inline const blNumberType& blCSVStreamIterator<blDataIteratorType,blNumberType>::getNumber()const
+{
+    return m_number;
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType>
+
+inline const std::ptrdiff_t& blCSVStreamIterator<blDataIteratorType,blNumberType>::rows()const
+{
+    return m_rows;
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType>
+
+inline const std::ptrdiff_t& blCSVStreamIterator<blDataIteratorType,blNumberType>::cols()const
+{
+    return m_cols;
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType>
+
+inline const std::ptrdiff_t& blCSVStreamIterator<blDataIteratorType,blNumberType>::rowIndex()const
+{
+    return m_rowIndex;
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType>
+
+inline const std::ptrdiff_t& blCSVStreamIterator<blDataIteratorType,blNumberType>::colIndex()const
+{
+    return m_colIndex;
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType>
+
+inline const std::ptrdiff_t& blCSVStreamIterator<blDataIteratorType,blNumberType>::dataIndex()const
+{
+    return m_dataIndex;
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType>
+
+inline const std::string& blCSVStreamIterator<blDataIteratorType,blNumberType>::rowTokens()const
+{
+    return m_rowTokens;
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType>
+
+inline const std::string& blCSVStreamIterator<blDataIteratorType,blNumberType>::colTokens()const
+{
+    return m_colTokens;
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType>
+
+inline const std::vector<std::string>& blCSVStreamIterator<blDataIteratorType,blNumberType>::getColumnNames()const
+{
+    return m_columnNames;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions use to get the begin/end iterators
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType>
+
+inline blCSVStreamIterator<blDataIteratorType,blNumberType> blCSVStreamIterator<blDataIteratorType,blNumberType>::begin()const
+{
+    return (*this);
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType>
+
+inline blCSVStreamIterator<blDataIteratorType,blNumberType> blCSVStreamIterator<blDataIteratorType,blNumberType>::end()const
+{
+    auto endIterator(*this);
+
+    endIterator.m_iter = m_endIter;
+    endIterator.m_dataPointEndIter = m_endIter;
+
+    return endIterator;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// End of namespace
+}
+//-------------------------------------------------------------------
+
+
+
+#endif // BL_CSVSTREAMITERATOR_HPP
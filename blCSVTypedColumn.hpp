@@ -0,0 +1,839 @@
+#ifndef BL_CSVTYPEDCOLUMN_HPP
+#define BL_CSVTYPEDCOLUMN_HPP
+
+
+
+//-------------------------------------------------------------------
+// FILE:            blCSVTypedColumn.hpp
+// CLASS:           blCSVTypedColumn
+//                  blColumnTypeInference
+// BASE CLASS:      None
+//
+//
+//
+// PURPOSE:         Classes used to parse csv columns into their
+//                  natural type instead of forcing every value
+//                  through the same number type
+//
+//                  -- blCSVTypedColumn holds the values of one csv
+//                     column stored in the width of its type:
+//
+//                     -- INT32_COLUMN        -- std::int32_t values
+//                     -- INT64_COLUMN        -- std::int64_t values
+//                     -- FLOAT_COLUMN        -- float values
+//                     -- DOUBLE_COLUMN       -- double values
+//                     -- CATEGORICAL_COLUMN  -- std::uint32_t codes
+//                                               into a dictionary of
+//                                               the distinct strings
+//
+//                     -- A column can be widened (INT32_COLUMN to
+//                        INT64_COLUMN to DOUBLE_COLUMN, FLOAT_COLUMN to
+//                        DOUBLE_COLUMN) keeping the values stored so far,
+//                        and it records the rows whose field could not be
+//                        parsed as a number of its type
+//
+//                  -- blColumnTypeInference looks at the fields of a
+//                     column one by one and picks the narrowest type
+//                     able to hold all of them:
+//
+//                     -- Integers that fit 32 bits are INT32_COLUMN,
+//                        bigger ones (up to 18 digits) are INT64_COLUMN
+//
+//                     -- Decimal numbers with up to 7 significant digits
+//                        (within the range of a float) are FLOAT_COLUMN,
+//                        the other ones are DOUBLE_COLUMN
+//
+//                     -- Integers mixed with decimal numbers widen the
+//                        column to FLOAT_COLUMN, or to DOUBLE_COLUMN when
+//                        a float would not hold them exactly
+//
+//                     -- Anything that is not a number makes the column
+//                        a CATEGORICAL_COLUMN
+//
+//                     -- A column without any field is a DOUBLE_COLUMN
+//
+//                  -- These classes are defined within the
+//                     "blAlgorithmsLIB" namespace
+//
+//
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+//
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Includes needed for this file
+//-------------------------------------------------------------------
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <cmath>
+#include <limits>
+#include <unordered_map>
+
+#include "blEnumsAndConstants.hpp"
+#include "blConvertToNumber.hpp"
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// NOTE: This class is defined within the blAlgorithmsLIB namespace
+//-------------------------------------------------------------------
+namespace blAlgorithmsLIB
+{
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+class blCSVTypedColumn
+{
+public: // Constructors and destructor
+
+
+
+    // Default constructor
+
+    blCSVTypedColumn()
+    {
+        m_columnType = DOUBLE_COLUMN;
+        m_size = 0;
+    }
+
+
+
+public: // Public functions
+
+
+
+    // Function used to clear the
+    // column and to size it to
+    // hold the specified number of
+    // values of the specified type
+    // (all set to zero)
+
+    void                                                                reset(const blColumnType& columnType,
+                                                                              const std::string& columnName,
+                                                                              const std::size_t& numberOfRows);
+
+
+
+    // Function used to change the
+    // type of the column to a wider
+    // one, converting the values
+    // stored so far (a narrower or
+    // categorical type is ignored)
+
+    void                                                                widenColumnType(const blColumnType& columnType);
+
+
+
+    // Functions used to get the
+    // type, name and number of
+    // values of the column
+
+    const blColumnType&                                                 getColumnType()const;
+    const std::string&                                                  getColumnName()const;
+    const std::size_t&                                                  size()const;
+
+
+
+    // Function used to get the
+    // number of bytes used to
+    // store the column's values
+    // (and categories)
+
+    std::size_t                                                         getMemoryUsage()const;
+
+
+
+    // Functions used to access the
+    // stored values, only the ones
+    // matching the column type are
+    // sized, the others are empty
+
+    std::vector<std::int32_t>&                                          getInt32Values();
+    std::vector<std::int64_t>&                                          getInt64Values();
+    std::vector<float>&                                                 getFloatValues();
+    std::vector<double>&                                                getDoubleValues();
+    std::vector<std::uint32_t>&                                         getCategoryCodes();
+
+    const std::vector<std::int32_t>&                                    getInt32Values()const;
+    const std::vector<std::int64_t>&                                    getInt64Values()const;
+    const std::vector<float>&                                           getFloatValues()const;
+    const std::vector<double>&                                          getDoubleValues()const;
+    const std::vector<std::uint32_t>&                                   getCategoryCodes()const;
+
+
+
+    // Functions used to get the
+    // distinct strings of a
+    // categorical column and the
+    // code of a string (which gets
+    // added to the categories if
+    // it is not one already)
+
+    const std::vector<std::string>&                                     getCategories()const;
+    std::uint32_t                                                       getCategoryCode(const std::string& category);
+
+
+
+    // Function used to get a value
+    // as a number of the specified
+    // type (a categorical column
+    // returns the value's code)
+
+    template<typename blNumberType>
+    blNumberType                                                        getNumber(const std::size_t& rowIndex)const;
+
+
+
+    // Function used to get the
+    // string of a value of a
+    // categorical column
+
+    const std::string&                                                  getCategory(const std::size_t& rowIndex)const;
+
+
+
+    // Functions used to record that
+    // the field of a row could not be
+    // parsed as a number (its value
+    // is set to zero) and to get the
+    // (increasing) indexes of those rows
+
+    void                                                                markRowAsUnparsable(const std::size_t& rowIndex);
+    const std::vector<std::size_t>&                                     getUnparsableRowIndexes()const;
+
+
+
+protected: // Protected variables
+
+
+
+    // Type, name and number
+    // of values of the column
+
+    blColumnType                                                        m_columnType;
+    std::string                                                         m_columnName;
+    std::size_t                                                         m_size;
+
+
+
+    // The stored values
+
+    std::vector<std::int32_t>                                           m_int32Values;
+    std::vector<std::int64_t>                                           m_int64Values;
+    std::vector<float>                                                  m_floatValues;
+    std::vector<double>                                                 m_doubleValues;
+    std::vector<std::uint32_t>                                          m_categoryCodes;
+
+
+
+    // The distinct strings of a
+    // categorical column and the
+    // map used to find their codes
+
+    std::vector<std::string>                                            m_categories;
+    std::unordered_map<std::string,std::uint32_t>                       m_categoryCodesByCategory;
+
+
+
+    // The rows whose field could not
+    // be parsed as a number
+
+    std::vector<std::size_t>                                            m_unparsableRowIndexes;
+};
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+class blColumnTypeInference
+{
+public: // Constructors and destructor
+
+
+
+    // Default constructor
+
+    blColumnTypeInference()
+    {
+        m_numberOfFields = 0;
+        m_hasInt32Fields = false;
+        m_hasInt64Fields = false;
+        m_hasIntegersTooBigForFloat = false;
+        m_hasFloatFields = false;
+        m_hasDoubleFields = false;
+        m_hasCategoricalFields = false;
+    }
+
+
+
+public: // Public functions
+
+
+
+    // Function used to look at
+    // the text of one more field
+    // of the column
+
+    template<typename blStringIteratorType>
+    void                                                                addField(const blStringIteratorType& beginIter,
+                                                                                 const blStringIteratorType& endIter);
+
+
+
+    // Function used to get the
+    // narrowest type able to hold
+    // all the fields seen so far
+
+    blColumnType                                                        getColumnType()const;
+
+
+
+    // Function used to get the
+    // number of fields seen so far
+
+    const std::size_t&                                                  getNumberOfFields()const;
+
+
+
+protected: // Protected variables
+
+
+
+    // Number of fields seen
+    // and the kinds of values
+    // found in them
+
+    std::size_t                                                         m_numberOfFields;
+
+    bool                                                                m_hasInt32Fields;
+    bool                                                                m_hasInt64Fields;
+    bool                                                                m_hasIntegersTooBigForFloat;
+    bool                                                                m_hasFloatFields;
+    bool                                                                m_hasDoubleFields;
+    bool                                                                m_hasCategoricalFields;
+};
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+inline void blCSVTypedColumn::reset(const blColumnType& columnType,
+                                    const std::string& columnName,
+                                    const std::size_t& numberOfRows)
+{
+    m_columnType = columnType;
+    m_columnName = columnName;
+    m_size = numberOfRows;
+
+    m_int32Values.clear();
+    m_int64Values.clear();
+    m_floatValues.clear();
+    m_doubleValues.clear();
+    m_categoryCodes.clear();
+    m_categories.clear();
+    m_categoryCodesByCategory.clear();
+    m_unparsableRowIndexes.clear();
+
+    switch(m_columnType)
+    {
+    case INT32_COLUMN:
+        m_int32Values.assign(numberOfRows,0);
+        break;
+    case INT64_COLUMN:
+        m_int64Values.assign(numberOfRows,0);
+        break;
+    case FLOAT_COLUMN:
+        m_floatValues.assign(numberOfRows,0.0f);
+        break;
+    case CATEGORICAL_COLUMN:
+        m_categoryCodes.assign(numberOfRows,0);
+        break;
+    default:
+        m_columnType = DOUBLE_COLUMN;
+        m_doubleValues.assign(numberOfRows,0.0);
+        break;
+    }
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+inline void blCSVTypedColumn::widenColumnType(const blColumnType& columnType)
+{
+    if(columnType == INT64_COLUMN && m_columnType == INT32_COLUMN)
+    {
+        m_int64Values.assign(m_int32Values.begin(),m_int32Values.end());
+        m_int32Values = std::vector<std::int32_t>();
+    }
+    else if(columnType == DOUBLE_COLUMN &&
+            (m_columnType == INT32_COLUMN ||
+             m_columnType == INT64_COLUMN ||
+             m_columnType == FLOAT_COLUMN))
+    {
+        m_doubleValues.resize(m_size);
+
+        for(std::size_t i = 0; i < m_size; ++i)
+            m_doubleValues[i] = getNumber<double>(i);
+
+        m_int32Values = std::vector<std::int32_t>();
+        m_int64Values = std::vector<std::int64_t>();
+        m_floatValues = std::vector<float>();
+    }
+    else
+    {
+        return;
+    }
+
+    m_columnType = columnType;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+inline const blColumnType& blCSVTypedColumn::getColumnType()const
+{
+    return m_columnType;
+}
+
+
+
+inline const std::string& blCSVTypedColumn::getColumnName()const
+{
+    return m_columnName;
+}
+
+
+
+inline const std::size_t& blCSVTypedColumn::size()const
+{
+    return m_size;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+inline std::size_t blCSVTypedColumn::getMemoryUsage()const
+{
+    std::size_t memoryUsage = m_int32Values.size() * sizeof(std::int32_t) +
+                              m_int64Values.size() * sizeof(std::int64_t) +
+                              m_floatValues.size() * sizeof(float) +
+                              m_doubleValues.size() * sizeof(double) +
+                              m_categoryCodes.size() * sizeof(std::uint32_t);
+
+    for(const auto& category : m_categories)
+        memoryUsage += category.size();
+
+    return memoryUsage;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+inline std::vector<std::int32_t>& blCSVTypedColumn::getInt32Values()
+{
+    return m_int32Values;
+}
+
+
+
+inline std::vector<std::int64_t>& blCSVTypedColumn::getInt64Values()
+{
+    return m_int64Values;
+}
+
+
+
+inline std::vector<float>& blCSVTypedColumn::getFloatValues()
+{
+    return m_floatValues;
+}
+
+
+
+inline std::vector<double>& blCSVTypedColumn::getDoubleValues()
+{
+    return m_doubleValues;
+}
+
+
+
+inline std::vector<std::uint32_t>& blCSVTypedColumn::getCategoryCodes()
+{
+    return m_categoryCodes;
+}
+
+
+
+inline const std::vector<std::int32_t>& blCSVTypedColumn::getInt32Values()const
+{
+    return m_int32Values;
+}
+
+
+
+inline const std::vector<std::int64_t>& blCSVTypedColumn::getInt64Values()const
+{
+    return m_int64Values;
+}
+
+
+
+inline const std::vector<float>& blCSVTypedColumn::getFloatValues()const
+{
+    return m_floatValues;
+}
+
+
+
+inline const std::vector<double>& blCSVTypedColumn::getDoubleValues()const
+{
+    return m_doubleValues;
+}
+
+
+
+inline const std::vector<std::uint32_t>& blCSVTypedColumn::getCategoryCodes()const
+{
+    return m_categoryCodes;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+inline const std::vector<std::string>& blCSVTypedColumn::getCategories()const
+{
+    return m_categories;
+}
+
+
+
+inline std::uint32_t blCSVTypedColumn::getCategoryCode(const std::string& category)
+{
+    auto categoryCodeIter = m_categoryCodesByCategory.find(category);
+
+    if(categoryCodeIter != m_categoryCodesByCategory.end())
+        return categoryCodeIter->second;
+
+
+
+    std::uint32_t categoryCode = static_cast<std::uint32_t>(m_categories.size());
+
+    m_categories.push_back(category);
+    m_categoryCodesByCategory.emplace(category,categoryCode);
+
+    return categoryCode;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+template<typename blNumberType>
+
+inline blNumberType blCSVTypedColumn::getNumber(const std::size_t& rowIndex)const
+{
+    if(rowIndex >= m_size)
+        return blNumberType(0);
+
+
+
+    switch(m_columnType)
+    {
+    case INT32_COLUMN:
+        return static_cast<blNumberType>(m_int32Values[rowIndex]);
+    case INT64_COLUMN:
+        return static_cast<blNumberType>(m_int64Values[rowIndex]);
+    case FLOAT_COLUMN:
+        return static_cast<blNumberType>(m_floatValues[rowIndex]);
+    case CATEGORICAL_COLUMN:
+        return static_cast<blNumberType>(m_categoryCodes[rowIndex]);
+    default:
+        return static_cast<blNumberType>(m_doubleValues[rowIndex]);
+    }
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+inline const std::string& blCSVTypedColumn::getCategory(const std::size_t& rowIndex)const
+{
+    static const std::string emptyCategory;
+
+    if(m_columnType != CATEGORICAL_COLUMN ||
+       rowIndex >= m_size ||
+       m_categoryCodes[rowIndex] >= m_categories.size())
+    {
+        return emptyCategory;
+    }
+
+    return m_categories[m_categoryCodes[rowIndex]];
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+inline void blCSVTypedColumn::markRowAsUnparsable(const std::size_t& rowIndex)
+{
+    if(rowIndex >= m_size)
+        return;
+
+
+
+    switch(m_columnType)
+    {
+    case INT32_COLUMN:
+        m_int32Values[rowIndex] = 0;
+        break;
+    case INT64_COLUMN:
+        m_int64Values[rowIndex] = 0;
+        break;
+    case FLOAT_COLUMN:
+        m_floatValues[rowIndex] = 0.0f;
+        break;
+    case CATEGORICAL_COLUMN:
+        return;
+    default:
+        m_doubleValues[rowIndex] = 0.0;
+        break;
+    }
+
+    m_unparsableRowIndexes.push_back(rowIndex);
+}
+
+
+
+inline const std::vector<std::size_t>& blCSVTypedColumn::getUnparsableRowIndexes()const
+{
+    return m_unparsableRowIndexes;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to classify the text of one field
+//-------------------------------------------------------------------
+template<typename blStringIteratorType>
+
+inline void blColumnTypeInference::addField(const blStringIteratorType& beginIter,
+                                            const blStringIteratorType& endIter)
+{
+    ++m_numberOfFields;
+
+    auto currentIter = beginIter;
+
+    bool isNumberNegative = false;
+
+    if(currentIter != endIter &&
+       ((*currentIter) == '-' || (*currentIter) == '+'))
+    {
+        isNumberNegative = ((*currentIter) == '-');
+        ++currentIter;
+    }
+
+
+
+    // We count the digits (the significant
+    // ones are the ones after any leading
+    // zeros) before and after the decimal
+    // point
+
+    std::size_t numberOfDigits = 0;
+    std::size_t numberOfSignificantDigits = 0;
+
+    std::uint64_t integerMagnitude = 0;
+
+    while(currentIter != endIter &&
+          (*currentIter) >= '0' &&
+          (*currentIter) <= '9')
+    {
+        if(numberOfSignificantDigits > 0 || (*currentIter) != '0')
+            ++numberOfSignificantDigits;
+
+        if(numberOfSignificantDigits <= 18)
+            integerMagnitude = integerMagnitude * 10 + static_cast<std::uint64_t>((*currentIter) - '0');
+
+        ++numberOfDigits;
+        ++currentIter;
+    }
+
+    bool hasDecimalPoint = false;
+
+    if(currentIter != endIter && (*currentIter) == '.')
+    {
+        hasDecimalPoint = true;
+        ++currentIter;
+
+        while(currentIter != endIter &&
+              (*currentIter) >= '0' &&
+              (*currentIter) <= '9')
+        {
+            if(numberOfSignificantDigits > 0 || (*currentIter) != '0')
+                ++numberOfSignificantDigits;
+
+            ++numberOfDigits;
+            ++currentIter;
+        }
+    }
+
+    bool hasExponent = false;
+
+    if(numberOfDigits > 0 &&
+       currentIter != endIter &&
+       ((*currentIter) == 'e' || (*currentIter) == 'E'))
+    {
+        hasExponent = true;
+        ++currentIter;
+
+        if(currentIter != endIter &&
+           ((*currentIter) == '-' || (*currentIter) == '+'))
+        {
+            ++currentIter;
+        }
+
+        std::size_t numberOfExponentDigits = 0;
+
+        while(currentIter != endIter &&
+              (*currentIter) >= '0' &&
+              (*currentIter) <= '9')
+        {
+            ++numberOfExponentDigits;
+            ++currentIter;
+        }
+
+        if(numberOfExponentDigits == 0)
+            numberOfDigits = 0;
+    }
+
+
+
+    // Anything that is not entirely
+    // a number is a categorical value
+
+    if(numberOfDigits == 0 || currentIter != endIter)
+    {
+        m_hasCategoricalFields = true;
+        return;
+    }
+
+
+
+    if(!hasDecimalPoint && !hasExponent)
+    {
+        if(numberOfSignificantDigits > 18)
+        {
+            m_hasDoubleFields = true;
+            return;
+        }
+
+        std::int64_t integer = isNumberNegative ? -static_cast<std::int64_t>(integerMagnitude) : static_cast<std::int64_t>(integerMagnitude);
+
+        if(integer >= std::numeric_limits<std::int32_t>::min() &&
+           integer <= std::numeric_limits<std::int32_t>::max())
+        {
+            m_hasInt32Fields = true;
+        }
+        else
+        {
+            m_hasInt64Fields = true;
+        }
+
+        // A float holds integers exactly
+        // only up to 2^24
+
+        if(integerMagnitude > (std::uint64_t(1) << 24))
+            m_hasIntegersTooBigForFloat = true;
+
+        return;
+    }
+
+
+
+    // A decimal number fits a float if it
+    // has few enough significant digits and
+    // is within the range of a float
+
+    double number = 0;
+
+    convertToNumber(beginIter,endIter,'.',number,0);
+
+    number = std::abs(number);
+
+    if(numberOfSignificantDigits <= 7 &&
+       (number == 0 ||
+        (number >= double(std::numeric_limits<float>::min()) &&
+         number <= double(std::numeric_limits<float>::max()))))
+    {
+        m_hasFloatFields = true;
+    }
+    else
+    {
+        m_hasDoubleFields = true;
+    }
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+inline blColumnType blColumnTypeInference::getColumnType()const
+{
+    if(m_hasCategoricalFields)
+        return CATEGORICAL_COLUMN;
+
+    if(m_hasFloatFields || m_hasDoubleFields)
+    {
+        if(m_hasDoubleFields || m_hasIntegersTooBigForFloat)
+            return DOUBLE_COLUMN;
+        else
+            return FLOAT_COLUMN;
+    }
+
+    if(m_hasInt64Fields)
+        return INT64_COLUMN;
+
+    if(m_hasInt32Fields)
+        return INT32_COLUMN;
+
+    return DOUBLE_COLUMN;
+}
+
+
+
+inline const std::size_t& blColumnTypeInference::getNumberOfFields()const
+{
+    return m_numberOfFields;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// End of namespace
+}
+//-------------------------------------------------------------------
+
+
+
+#endif // BL_CSVTYPEDCOLUMN_HPP
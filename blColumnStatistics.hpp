@@ -0,0 +1,428 @@
+#ifndef BL_COLUMNSTATISTICS_HPP
+#define BL_COLUMNSTATISTICS_HPP
+
+
+
+//-------------------------------------------------------------------
+// FILE:            blColumnStatistics.hpp
+// CLASS:           blColumnStatistics
+// BASE CLASS:      None
+//
+//
+//
+// PURPOSE:         Class used to compute the statistics of a column
+//                  of values (count, NaN count, min, max, mean, variance
+//                  and an estimate of the number of distinct values) in
+//                  a single pass
+//
+//                  -- The mean and variance are updated one value at a
+//                     time (Welford's algorithm), so they stay accurate
+//                     even for long columns with a large mean
+//
+//                  -- The number of distinct values is estimated with a
+//                     HyperLogLog sketch of 1024 registers, which uses
+//                     1KB of memory no matter how many values are added
+//                     and has a typical error of about 3%
+//
+//                  -- Two statistics computed over different parts of
+//                     the same column can be merged (Chan's algorithm
+//                     for the mean and variance), which is what allows
+//                     a column to be split across multiple threads
+//
+//                  -- This class is defined within the
+//                     "blAlgorithmsLIB" namespace
+//
+//
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+//
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Includes needed for this file
+//-------------------------------------------------------------------
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// NOTE: This class is defined within the blAlgorithmsLIB namespace
+//-------------------------------------------------------------------
+namespace blAlgorithmsLIB
+{
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+class blColumnStatistics
+{
+public: // Constructors and destructor
+
+
+
+    // Default constructor
+
+    blColumnStatistics()
+    {
+        clear();
+    }
+
+
+
+public: // Public functions
+
+
+
+    // Function used to reset
+    // the statistics
+
+    void                                                                clear();
+
+
+
+    // Functions used to add a value
+    // (a NaN value is only counted)
+    // or a field that is not a number
+
+    void                                                                addValue(const double& value);
+    void                                                                addNaN();
+
+
+
+    // Function used to merge the
+    // statistics of another part
+    // of the same column
+
+    void                                                                merge(const blColumnStatistics& columnStatistics);
+
+
+
+    // Functions used to get the
+    // number of values (not counting
+    // NaNs) and the number of NaNs
+
+    const std::size_t&                                                  getCount()const;
+    const std::size_t&                                                  getNaNCount()const;
+
+
+
+    // Functions used to get the
+    // statistics of the values (they
+    // are NaN when there are no values)
+    // The variance is the sample one
+    // (divided by count - 1)
+
+    double                                                              getMin()const;
+    double                                                              getMax()const;
+    double                                                              getMean()const;
+    double                                                              getVariance()const;
+    double                                                              getPopulationVariance()const;
+    double                                                              getStandardDeviation()const;
+
+
+
+    // Function used to get the estimated
+    // number of distinct values
+
+    double                                                              getDistinctCountEstimate()const;
+
+
+
+private: // Static functions/variables/constants
+
+
+
+    // Number of bits of a value's hash
+    // used to pick its sketch register
+
+    static const int                                                    s_sketchPrecision = 10;
+
+
+
+protected: // Protected variables
+
+
+
+    // Number of values and NaNs
+
+    std::size_t                                                         m_count;
+    std::size_t                                                         m_nanCount;
+
+
+
+    // Running min, max, mean and
+    // sum of squared differences
+    // from the mean
+
+    double                                                              m_min;
+    double                                                              m_max;
+    double                                                              m_mean;
+    double                                                              m_sumOfSquaredDifferences;
+
+
+
+    // Registers of the sketch used
+    // to estimate the number of
+    // distinct values
+
+    std::vector<std::uint8_t>                                           m_sketchRegisters;
+};
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+inline void blColumnStatistics::clear()
+{
+    m_count = 0;
+    m_nanCount = 0;
+
+    m_min = std::numeric_limits<double>::infinity();
+    m_max = -std::numeric_limits<double>::infinity();
+    m_mean = 0;
+    m_sumOfSquaredDifferences = 0;
+
+    m_sketchRegisters.assign(std::size_t(1) << s_sketchPrecision,0);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+inline void blColumnStatistics::addValue(const double& value)
+{
+    if(std::isnan(value))
+    {
+        addNaN();
+        return;
+    }
+
+
+
+    ++m_count;
+
+    m_min = std::min(m_min,value);
+    m_max = std::max(m_max,value);
+
+    double difference = value - m_mean;
+
+    m_mean += difference / double(m_count);
+    m_sumOfSquaredDifferences += difference * (value - m_mean);
+
+
+
+    // We hash the bits of the value
+    // (splitmix64), the first bits of
+    // the hash pick the register and
+    // the position of the first set bit
+    // in the rest of it is the rank
+    // NOTE:  -0 and 0 are the same value
+
+    double normalizedValue = (value == 0) ? 0.0 : value;
+
+    std::uint64_t hash = 0;
+    std::memcpy(&hash,&normalizedValue,sizeof(hash));
+
+    hash += 0x9E3779B97F4A7C15ull;
+    hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ull;
+    hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBull;
+    hash = hash ^ (hash >> 31);
+
+    std::size_t registerIndex = static_cast<std::size_t>(hash >> (64 - s_sketchPrecision));
+
+    std::uint64_t remainingBits = hash << s_sketchPrecision;
+
+    std::uint8_t rank = 1;
+
+    while(rank <= 64 - s_sketchPrecision &&
+          (remainingBits & (std::uint64_t(1) << 63)) == 0)
+    {
+        remainingBits <<= 1;
+        ++rank;
+    }
+
+    m_sketchRegisters[registerIndex] = std::max(m_sketchRegisters[registerIndex],rank);
+}
+
+
+
+inline void blColumnStatistics::addNaN()
+{
+    ++m_nanCount;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+inline void blColumnStatistics::merge(const blColumnStatistics& columnStatistics)
+{
+    m_nanCount += columnStatistics.m_nanCount;
+
+    if(columnStatistics.m_count == 0)
+        return;
+
+
+
+    std::size_t totalCount = m_count + columnStatistics.m_count;
+
+    double difference = columnStatistics.m_mean - m_mean;
+
+    m_mean += difference * double(columnStatistics.m_count) / double(totalCount);
+
+    m_sumOfSquaredDifferences += columnStatistics.m_sumOfSquaredDifferences +
+                                 difference * difference * double(m_count) * double(columnStatistics.m_count) / double(totalCount);
+
+    m_count = totalCount;
+
+    m_min = std::min(m_min,columnStatistics.m_min);
+    m_max = std::max(m_max,columnStatistics.m_max);
+
+
+
+    for(std::size_t i = 0; i < m_sketchRegisters.size(); ++i)
+        m_sketchRegisters[i] = std::max(m_sketchRegisters[i],columnStatistics.m_sketchRegisters[i]);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+inline const std::size_t& blColumnStatistics::getCount()const
+{
+    return m_count;
+}
+
+
+
+inline const std::size_t& blColumnStatistics::getNaNCount()const
+{
+    return m_nanCount;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+inline double blColumnStatistics::getMin()const
+{
+    if(m_count == 0)
+        return std::numeric_limits<double>::quiet_NaN();
+
+    return m_min;
+}
+
+
+
+inline double blColumnStatistics::getMax()const
+{
+    if(m_count == 0)
+        return std::numeric_limits<double>::quiet_NaN();
+
+    return m_max;
+}
+
+
+
+inline double blColumnStatistics::getMean()const
+{
+    if(m_count == 0)
+        return std::numeric_limits<double>::quiet_NaN();
+
+    return m_mean;
+}
+
+
+
+inline double blColumnStatistics::getVariance()const
+{
+    if(m_count < 2)
+        return std::numeric_limits<double>::quiet_NaN();
+
+    return m_sumOfSquaredDifferences / double(m_count - 1);
+}
+
+
+
+inline double blColumnStatistics::getPopulationVariance()const
+{
+    if(m_count == 0)
+        return std::numeric_limits<double>::quiet_NaN();
+
+    return m_sumOfSquaredDifferences / double(m_count);
+}
+
+
+
+inline double blColumnStatistics::getStandardDeviation()const
+{
+    return std::sqrt(getVariance());
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+inline double blColumnStatistics::getDistinctCountEstimate()const
+{
+    if(m_count == 0)
+        return 0;
+
+
+
+    double numberOfRegisters = double(m_sketchRegisters.size());
+
+    double sumOfInversePowers = 0;
+    std::size_t numberOfEmptyRegisters = 0;
+
+    for(const auto& sketchRegister : m_sketchRegisters)
+    {
+        sumOfInversePowers += std::ldexp(1.0,-int(sketchRegister));
+
+        if(sketchRegister == 0)
+            ++numberOfEmptyRegisters;
+    }
+
+    double alpha = 0.7213 / (1.0 + 1.079 / numberOfRegisters);
+
+    double estimate = alpha * numberOfRegisters * numberOfRegisters / sumOfInversePowers;
+
+
+
+    // For small counts the raw estimate
+    // is biased, so we count the empty
+    // registers instead (linear counting)
+
+    if(estimate <= 2.5 * numberOfRegisters && numberOfEmptyRegisters > 0)
+        estimate = numberOfRegisters * std::log(numberOfRegisters / double(numberOfEmptyRegisters));
+
+    return estimate;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// End of namespace
+}
+//-------------------------------------------------------------------
+
+
+
+#endif // BL_COLUMNSTATISTICS_HPP
@@ -53,6 +53,8 @@
 //-------------------------------------------------------------------
 #include <cmath>
 #include <cstdint>
+#include <limits>
+#include <type_traits>
 #include "blCyclicStlAlgorithms.hpp"
 //-------------------------------------------------------------------
 
@@ -376,6 +378,157 @@ inline blStringIteratorType convertToNumber(const blStringIteratorType& beginIte
 
 
 
+//-------------------------------------------------------------------
+// Function used to convert a string to an integer number,
+// returning an iterator pointing right after the last
+// digit used
+//
+// NOTE:  Unlike convertToNumber, this function does not
+//        handle decimal points or exponents, it stops at
+//        the first character that is not a digit, which
+//        makes it faster when the string is known to hold
+//        an integer
+//-------------------------------------------------------------------
+template<typename blStringIteratorType,
+         typename blIntegerType>
+
+inline blStringIteratorType convertToInteger(const blStringIteratorType& beginIter,
+                                             const blStringIteratorType& endIter,
+                                             blIntegerType& convertedInteger)
+{
+    convertedInteger = blIntegerType(0);
+
+    if(beginIter == endIter)
+        return endIter;
+
+
+
+    blStringIteratorType currentPos = beginIter;
+
+    bool isNumberNegative = false;
+
+    if((*currentPos) == '-')
+    {
+        isNumberNegative = true;
+        ++currentPos;
+    }
+    else if((*currentPos) == '+')
+    {
+        ++currentPos;
+    }
+
+
+
+    // We accumulate the digits in the
+    // unsigned version of the type, so
+    // that integers too big for the type
+    // wrap around instead of overflowing
+
+    typename std::make_unsigned<blIntegerType>::type magnitude = 0;
+
+    while(currentPos != endIter &&
+          (*currentPos) >= '0' &&
+          (*currentPos) <= '9')
+    {
+        magnitude = magnitude * 10u + static_cast<unsigned>((*currentPos) - '0');
+        ++currentPos;
+    }
+
+    if(isNumberNegative)
+        magnitude = 0u - magnitude;
+
+    convertedInteger = static_cast<blIntegerType>(magnitude);
+
+
+
+    return currentPos;
+}
+
+
+
+//-------------------------------------------------------------------
+// Same as above, but also telling whether the integer
+// fit the type (when it doesn't, the converted integer
+// is set to zero instead of wrapping around)
+//-------------------------------------------------------------------
+template<typename blStringIteratorType,
+         typename blIntegerType>
+
+inline blStringIteratorType convertToInteger(const blStringIteratorType& beginIter,
+                                             const blStringIteratorType& endIter,
+                                             blIntegerType& convertedInteger,
+                                             bool& hasIntegerFit)
+{
+    typedef typename std::make_unsigned<blIntegerType>::type blUnsignedIntegerType;
+
+    convertedInteger = blIntegerType(0);
+    hasIntegerFit = true;
+
+    if(beginIter == endIter)
+        return endIter;
+
+
+
+    blStringIteratorType currentPos = beginIter;
+
+    bool isNumberNegative = false;
+
+    if((*currentPos) == '-')
+    {
+        isNumberNegative = true;
+        ++currentPos;
+    }
+    else if((*currentPos) == '+')
+    {
+        ++currentPos;
+    }
+
+
+
+    // The biggest magnitude allowed is one
+    // more for negative integers (for ex.
+    // -2147483648 for a 32 bits integer)
+
+    blUnsignedIntegerType maxMagnitude = static_cast<blUnsignedIntegerType>(std::numeric_limits<blIntegerType>::max());
+
+    if(isNumberNegative && std::numeric_limits<blIntegerType>::is_signed)
+        maxMagnitude += 1u;
+
+    blUnsignedIntegerType magnitude = 0;
+
+    while(currentPos != endIter &&
+          (*currentPos) >= '0' &&
+          (*currentPos) <= '9')
+    {
+        blUnsignedIntegerType digit = static_cast<blUnsignedIntegerType>((*currentPos) - '0');
+
+        if(magnitude > (maxMagnitude - digit) / 10u)
+            hasIntegerFit = false;
+        else
+            magnitude = magnitude * 10u + digit;
+
+        ++currentPos;
+    }
+
+    if(isNumberNegative && !std::numeric_limits<blIntegerType>::is_signed && magnitude != 0u)
+        hasIntegerFit = false;
+
+    if(!hasIntegerFit)
+        return currentPos;
+
+    if(isNumberNegative)
+        magnitude = 0u - magnitude;
+
+    convertedInteger = static_cast<blIntegerType>(magnitude);
+
+
+
+    return currentPos;
+}
+//-------------------------------------------------------------------
+
+
+
 //-------------------------------------------------------------------
 // Convenient template functions to simplify the
 // use of the string to number conversion function
@@ -422,6 +575,36 @@ inline double convertStringToDouble(const blStringType& inputString)
 
 
 
+//-------------------------------------------------------------------
+// The default number conversion policy of the text iterators
+// of this library (blCSVMatrixIterator and
+// blTextColumnVectorIterator), it calls the convertToNumber
+// function above with a '.' decimal point
+//
+// NOTE:  A custom policy is any class with the same call
+//        operator, returning an iterator pointing right after
+//        the characters used for the conversion, and is passed
+//        as the last template argument of the iterators
+//-------------------------------------------------------------------
+class blDefaultNumberConverter
+{
+public: // Public functions
+
+
+
+    template<typename blStringIteratorType,
+             typename blNumberType>
+    blStringIteratorType                                                operator()(const blStringIteratorType& beginIter,
+                                                                                   const blStringIteratorType& endIter,
+                                                                                   blNumberType& convertedNumber)const
+    {
+        return convertToNumber(beginIter,endIter,'.',convertedNumber,0);
+    }
+};
+//-------------------------------------------------------------------
+
+
+
 //-------------------------------------------------------------------
 // Function used to convert a string of multiple numbers to
 // an array of numbers
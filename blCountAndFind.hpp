@@ -40,6 +40,10 @@
 // Includes needed for these functions
 //-------------------------------------------------------------------
 #include <iterator>
+#include <vector>
+#include <cstddef>
+#include <cmath>
+#include <algorithm>
 
 #include "blCyclicStlAlgorithms.hpp"
 //-------------------------------------------------------------------
@@ -429,6 +433,114 @@ inline std::size_t countDataRows(const blDataIteratorType& beginIter,
 
 
 
+//-------------------------------------------------------------------
+// The following function counts the number of data
+// rows in a buffer (just like the above function) but
+// it also records the offset (measured from a user
+// specified origin iterator) of the beginning of each
+// data row found, so that a row can later be reached
+// without having to re-scan the buffer
+//
+// NOTE:  The offsets are appended to the user
+//        supplied container, which must define
+//        the "push_back" function
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blTokenIteratorType,
+         typename blOffsetContainerType>
+
+inline std::size_t findOffsetsOfAllDataRows(const blDataIteratorType& beginIter,
+                                            const blDataIteratorType& endIter,
+                                            const blTokenIteratorType& rowTokensBeginIter,
+                                            const blTokenIteratorType& rowTokensEndIter,
+                                            const bool& shouldZeroLengthRowsBeCounted,
+                                            const blDataIteratorType& offsetOriginIter,
+                                            blOffsetContainerType& rowOffsets)
+{
+    // Check the inputs
+
+    if(beginIter == endIter)
+    {
+        // In this case there
+        // are no rows
+
+        return std::size_t(0);
+    }
+
+    // Iterators used to
+    // find the tokens in
+    // the data buffer
+
+    blDataIteratorType firstTokenIterator = beginIter;
+    blDataIteratorType secondTokenIterator = beginIter;
+
+    // The total number
+    // of rows found by
+    // this function
+
+    std::size_t totalNumberOfRows = std::size_t(0);
+
+    while(firstTokenIterator != endIter)
+    {
+        // Find the next
+        // token in the
+        // data
+
+        secondTokenIterator = blAlgorithmsLIB::find_first_of(firstTokenIterator,
+                                                             endIter,
+                                                             rowTokensBeginIter,
+                                                             rowTokensEndIter,
+                                                             0);
+
+        if(secondTokenIterator == firstTokenIterator &&
+           !shouldZeroLengthRowsBeCounted)
+        {
+            // In this case,
+            // we do not want
+            // to count this
+            // as a data row
+
+            ++firstTokenIterator;
+        }
+        else
+        {
+            // Increse the total
+            // number of rows and
+            // record where the
+            // row begins
+
+            ++totalNumberOfRows;
+
+            rowOffsets.push_back(std::distance(offsetOriginIter,firstTokenIterator));
+
+            firstTokenIterator = secondTokenIterator;
+
+            // Advance the iterator
+            // if we've not reached
+            // the end yet
+
+            if(firstTokenIterator != endIter)
+                ++firstTokenIterator;
+
+            // In case of circular
+            // iterators we might
+            // be back to the
+            // beginning, so we
+            // quit in that case
+
+            if(firstTokenIterator == beginIter)
+                break;
+        }
+    }
+
+    // We're done counting
+
+    return totalNumberOfRows;
+}
+//-------------------------------------------------------------------
+
+
+
 //-------------------------------------------------------------------
 // The following functions find data rows in a
 // buffer by searching for the specified row
@@ -864,6 +976,284 @@ inline blDataIteratorType countDataRowsAndLongestRowLength(const blDataIteratorT
 
 
 
+//-------------------------------------------------------------------
+// The estimate of the number of rows in a buffer
+// computed by the "estimateDataRows" function below
+//-------------------------------------------------------------------
+class blDataRowsEstimate
+{
+public: // Public variables
+
+
+
+    // The estimated number of rows, and
+    // the bounds within which the actual
+    // number of rows lies with about 95%
+    // confidence
+
+    std::size_t                                                         m_numberOfRows;
+    std::size_t                                                         m_lowerBound;
+    std::size_t                                                         m_upperBound;
+
+
+
+    // The average length of the sampled
+    // rows (counting their row tokens) and
+    // the length of the longest one
+
+    double                                                              m_averageRowLength;
+    std::size_t                                                         m_lengthOfLongestSampledRow;
+
+
+
+    // The number of rows and of bytes
+    // that were actually counted
+
+    std::size_t                                                         m_numberOfSampledRows;
+    std::size_t                                                         m_numberOfSampledBytes;
+
+
+
+    // Flag telling us whether the whole
+    // buffer was counted, in which case
+    // the bounds are the number of rows
+
+    bool                                                                m_isExact;
+};
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// The following function estimates the number of rows
+// in a buffer without reading all of it, by counting the
+// rows in a few evenly spaced windows of the buffer and
+// scaling the number of rows per byte found in them to
+// the length of the buffer
+//
+// -- Each window starts at the first row that begins in
+//    it and ends at the end of the row where the window
+//    ends, so only whole rows are counted
+//
+// -- The bounds come from how much the number of rows
+//    per byte varies from window to window
+//
+// -- When the windows would cover the whole buffer, the
+//    rows are simply counted
+//
+// NOTE:  The iterators are advanced to each window, so
+//        this function only reads a small part of the
+//        buffer when they are random access iterators
+//        (for ex. the iterators of a memory mapped file)
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blTokenType>
+
+inline blDataRowsEstimate estimateDataRows(const blDataIteratorType& beginIter,
+                                           const blDataIteratorType& endIter,
+                                           const blTokenType& rowToken,
+                                           const bool& shouldZeroLengthRowsBeCounted,
+                                           const std::size_t& numberOfWindows = 32,
+                                           const std::size_t& windowLength = 1 << 16)
+{
+    blDataRowsEstimate estimate;
+
+    estimate.m_numberOfRows = 0;
+    estimate.m_lowerBound = 0;
+    estimate.m_upperBound = 0;
+    estimate.m_averageRowLength = 0;
+    estimate.m_lengthOfLongestSampledRow = 0;
+    estimate.m_numberOfSampledRows = 0;
+    estimate.m_numberOfSampledBytes = 0;
+    estimate.m_isExact = false;
+
+    std::ptrdiff_t dataLength = std::distance(beginIter,endIter);
+
+    std::ptrdiff_t windowsLength = static_cast<std::ptrdiff_t>(std::max(numberOfWindows,std::size_t(1)) *
+                                                               std::max(windowLength,std::size_t(1)));
+
+
+
+    // When the windows would cover
+    // the whole buffer, we simply
+    // count its rows
+
+    if(dataLength <= windowsLength || numberOfWindows < 2)
+    {
+        std::size_t totalNumberOfRows = 0;
+        std::size_t lengthOfLongestRow = 0;
+
+        countDataRowsAndLongestRowLength(beginIter,
+                                         endIter,
+                                         rowToken,
+                                         shouldZeroLengthRowsBeCounted,
+                                         totalNumberOfRows,
+                                         lengthOfLongestRow);
+
+        estimate.m_numberOfRows = totalNumberOfRows;
+        estimate.m_lowerBound = totalNumberOfRows;
+        estimate.m_upperBound = totalNumberOfRows;
+        estimate.m_lengthOfLongestSampledRow = lengthOfLongestRow;
+        estimate.m_numberOfSampledRows = totalNumberOfRows;
+        estimate.m_numberOfSampledBytes = static_cast<std::size_t>(dataLength);
+        estimate.m_isExact = true;
+
+        if(totalNumberOfRows > 0)
+            estimate.m_averageRowLength = double(dataLength) / double(totalNumberOfRows);
+
+        return estimate;
+    }
+
+
+
+    // The number of rows and bytes
+    // counted in each window
+
+    std::vector<double> windowRows;
+    std::vector<double> windowBytes;
+
+    std::ptrdiff_t distanceBetweenWindows = (dataLength - static_cast<std::ptrdiff_t>(windowLength)) /
+                                            static_cast<std::ptrdiff_t>(numberOfWindows - 1);
+
+    blDataIteratorType windowBeginIter = beginIter;
+    std::ptrdiff_t windowBeginOffset = 0;
+
+    for(std::size_t i = 0; i < numberOfWindows; ++i)
+    {
+        // We move to the beginning of
+        // the window, and then to the
+        // first row that begins in it
+
+        std::ptrdiff_t nextWindowBeginOffset = static_cast<std::ptrdiff_t>(i) * distanceBetweenWindows;
+
+        std::advance(windowBeginIter,nextWindowBeginOffset - windowBeginOffset);
+        windowBeginOffset = nextWindowBeginOffset;
+
+        blDataIteratorType sampleBeginIter = windowBeginIter;
+
+        if(windowBeginOffset > 0)
+        {
+            sampleBeginIter = find(windowBeginIter,endIter,rowToken,0);
+
+            if(sampleBeginIter == endIter)
+                continue;
+
+            ++sampleBeginIter;
+        }
+
+        std::ptrdiff_t sampleBeginOffset = windowBeginOffset + std::distance(windowBeginIter,sampleBeginIter);
+
+        if(sampleBeginOffset >= dataLength)
+            continue;
+
+
+
+        // The window ends at the
+        // end of its last row
+
+        blDataIteratorType sampleEndIter = sampleBeginIter;
+
+        std::advance(sampleEndIter,std::min(static_cast<std::ptrdiff_t>(windowLength),dataLength - sampleBeginOffset) - 1);
+
+        sampleEndIter = find(sampleEndIter,endIter,rowToken,0);
+
+        if(sampleEndIter != endIter)
+            ++sampleEndIter;
+
+
+
+        std::size_t numberOfRows = 0;
+        std::size_t lengthOfLongestRow = 0;
+
+        countDataRowsAndLongestRowLength(sampleBeginIter,
+                                         sampleEndIter,
+                                         rowToken,
+                                         shouldZeroLengthRowsBeCounted,
+                                         numberOfRows,
+                                         lengthOfLongestRow);
+
+        std::size_t numberOfBytes = static_cast<std::size_t>(std::distance(sampleBeginIter,sampleEndIter));
+
+        windowRows.push_back(double(numberOfRows));
+        windowBytes.push_back(double(numberOfBytes));
+
+        estimate.m_numberOfSampledRows += numberOfRows;
+        estimate.m_numberOfSampledBytes += numberOfBytes;
+        estimate.m_lengthOfLongestSampledRow = std::max(estimate.m_lengthOfLongestSampledRow,lengthOfLongestRow);
+    }
+
+    if(estimate.m_numberOfSampledBytes == 0)
+        return estimate;
+
+
+
+    // The estimate is the number of rows
+    // per byte (ratio estimator) scaled
+    // to the length of the buffer
+
+    double rowsPerByte = double(estimate.m_numberOfSampledRows) / double(estimate.m_numberOfSampledBytes);
+
+    double numberOfRows = rowsPerByte * double(dataLength);
+
+    estimate.m_numberOfRows = static_cast<std::size_t>(numberOfRows + 0.5);
+
+    if(estimate.m_numberOfSampledRows > 0)
+        estimate.m_averageRowLength = 1.0 / rowsPerByte;
+
+
+
+    // The standard error of the ratio
+    // estimator, with a finite population
+    // correction for the part of the buffer
+    // that was counted, and a 95% bound of
+    // 1.96 standard errors
+
+    double numberOfSamples = double(windowRows.size());
+    double halfWidthOfBounds = double(dataLength);
+
+    if(windowRows.size() > 1)
+    {
+        double sumOfSquaredResiduals = 0;
+
+        for(std::size_t i = 0; i < windowRows.size(); ++i)
+        {
+            double residual = windowRows[i] - rowsPerByte * windowBytes[i];
+            sumOfSquaredResiduals += residual * residual;
+        }
+
+        double averageWindowBytes = double(estimate.m_numberOfSampledBytes) / numberOfSamples;
+
+        double sampledFraction = std::min(double(estimate.m_numberOfSampledBytes) / double(dataLength),1.0);
+
+        double standardErrorOfRowsPerByte = std::sqrt(sumOfSquaredResiduals / (numberOfSamples - 1.0) / numberOfSamples * (1.0 - sampledFraction)) /
+                                            averageWindowBytes;
+
+        halfWidthOfBounds = 1.96 * standardErrorOfRowsPerByte * double(dataLength);
+    }
+
+
+
+    // The buffer has at least the rows
+    // counted, and (unless zero length
+    // rows are counted) at most one row
+    // every two bytes
+
+    estimate.m_lowerBound = std::max(static_cast<std::size_t>(std::max(numberOfRows - halfWidthOfBounds,0.0)),
+                                     estimate.m_numberOfSampledRows);
+
+    estimate.m_upperBound = static_cast<std::size_t>(std::ceil(numberOfRows + halfWidthOfBounds));
+
+    if(!shouldZeroLengthRowsBeCounted)
+        estimate.m_upperBound = std::min(estimate.m_upperBound,static_cast<std::size_t>(dataLength / 2 + 1));
+
+    estimate.m_numberOfRows = std::min(std::max(estimate.m_numberOfRows,estimate.m_lowerBound),estimate.m_upperBound);
+
+    return estimate;
+}
+//-------------------------------------------------------------------
+
+
+
 //-------------------------------------------------------------------
 // THe following functions find the corresponding
 // row and column position of the user specified
@@ -1195,6 +1585,124 @@ inline blIntegerType findBeginningOfNthDataPoint(const blDataIteratorType& dataB
 
 
 
+//-------------------------------------------------------------------
+// This function counts all the data points in a buffer
+// (data points are separated by any of the user specified
+// tokens) and while doing so it records the offset
+// (measured from a user specified origin iterator) of the
+// beginning of every Nth data point, that is data points
+// 0, N, 2N, 3N and so on
+//
+// NOTE:  The offsets are appended to the user
+//        supplied container, which must define
+//        the "push_back" function
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blTokenIteratorType,
+         typename blIntegerType,
+         typename blOffsetContainerType>
+
+inline blIntegerType findOffsetsOfEveryNthDataPoint(const blDataIteratorType& dataBeginIter,
+                                                    const blDataIteratorType& dataEndIter,
+                                                    const blTokenIteratorType& tokenListBeginIter,
+                                                    const blTokenIteratorType& tokenListEndIter,
+                                                    const bool& shouldZeroLengthRowsBeCounted,
+                                                    const blIntegerType& intervalBetweenRecordedDataPoints,
+                                                    const blDataIteratorType& offsetOriginIter,
+                                                    blOffsetContainerType& dataPointOffsets)
+{
+    // Check the inputs
+
+    if(dataBeginIter == dataEndIter ||
+       intervalBetweenRecordedDataPoints <= blIntegerType(0))
+    {
+        return blIntegerType(0);
+    }
+
+
+
+    // The iterator
+    // to the tokens
+    // found in the data
+
+    blDataIteratorType firstTokenIterator = dataBeginIter;
+    blDataIteratorType secondTokenIterator = dataBeginIter;
+
+
+
+    // The total number
+    // of data points
+
+    blIntegerType totalNumberOfDataPoints = blIntegerType(0);
+
+
+
+    while(firstTokenIterator != dataEndIter)
+    {
+        // Find the next
+        // token in the
+        // data
+
+        secondTokenIterator = blAlgorithmsLIB::find_first_of(firstTokenIterator,
+                                                             dataEndIter,
+                                                             tokenListBeginIter,
+                                                             tokenListEndIter,
+                                                             0);
+
+
+
+        if(secondTokenIterator == firstTokenIterator &&
+           !shouldZeroLengthRowsBeCounted)
+        {
+            // In this case,
+            // the data point is
+            // of zero length and
+            // we don't count it
+
+            ++firstTokenIterator;
+        }
+        else
+        {
+            // Record the data
+            // point if it's one
+            // of the Nth ones
+
+            if(totalNumberOfDataPoints % intervalBetweenRecordedDataPoints == blIntegerType(0))
+                dataPointOffsets.push_back(std::distance(offsetOriginIter,firstTokenIterator));
+
+            ++totalNumberOfDataPoints;
+
+            firstTokenIterator = secondTokenIterator;
+
+            // If we have not
+            // reached the end,
+            // then we advance
+            // the iterator
+
+            if(firstTokenIterator != dataEndIter)
+                ++firstTokenIterator;
+
+            // In case of circular
+            // iterators we might
+            // be back to the
+            // beginning, so we
+            // quit in that case
+
+            if(firstTokenIterator == dataBeginIter)
+                break;
+        }
+    }
+
+
+
+    // We're done
+
+    return totalNumberOfDataPoints;
+}
+//-------------------------------------------------------------------
+
+
+
 //-------------------------------------------------------------------
 // This function gets an iterator to the
 // beginning of the user specified nth row.
@@ -1443,6 +1951,304 @@ inline blIntegerType findBeginAndEndOfNthDataPoint(const blDataIteratorType& dat
 
 
 
+//-------------------------------------------------------------------
+// The following functions are quote-aware versions of
+// the token-list functions above, tokens found between
+// a pair of quote tokens (for ex. the comma in "1,234.5"
+// in a csv file) are not counted as tokens
+//
+// -- An escaped quote (two consecutive quote tokens
+//    inside a quoted field) simply toggles the quote
+//    state twice, so it needs no special handling
+//
+// NOTE:  These functions assume that the
+//        data begins outside of any quotes
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// This function walks the data points in a buffer and
+// calls the user functor with the begin and end iterators
+// of each data point found
+// The functor returns false to stop the walk
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blTokenIteratorType,
+         typename blQuoteTokenType,
+         typename blFunctorType>
+
+inline void forEachDataPointRespectingQuotes(const blDataIteratorType& dataBeginIter,
+                                             const blDataIteratorType& dataEndIter,
+                                             const blTokenIteratorType& tokenListBeginIter,
+                                             const blTokenIteratorType& tokenListEndIter,
+                                             const bool& shouldZeroLengthRowsBeCounted,
+                                             const blQuoteTokenType& quoteToken,
+                                             blFunctorType& functor)
+{
+    blDataIteratorType currentIter = dataBeginIter;
+    blDataIteratorType dataPointBeginIter = dataBeginIter;
+
+    bool isInsideQuotes = false;
+
+
+
+    while(currentIter != dataEndIter)
+    {
+        if((*currentIter) == quoteToken)
+        {
+            isInsideQuotes = !isInsideQuotes;
+        }
+        else if(!isInsideQuotes &&
+                blAlgorithmsLIB::find(tokenListBeginIter,tokenListEndIter,*currentIter,0) != tokenListEndIter)
+        {
+            // We found a token outside
+            // of quotes, so it ends the
+            // current data point
+
+            if(currentIter != dataPointBeginIter ||
+               shouldZeroLengthRowsBeCounted)
+            {
+                if(!functor(dataPointBeginIter,currentIter))
+                    return;
+            }
+
+            dataPointBeginIter = currentIter;
+            ++dataPointBeginIter;
+        }
+
+        ++currentIter;
+    }
+
+
+
+    // The last data point is
+    // ended by the end of the
+    // data instead of a token
+
+    if(dataPointBeginIter != dataEndIter)
+        functor(dataPointBeginIter,dataEndIter);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Quote-aware version of "countDataRows"
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blTokenIteratorType,
+         typename blQuoteTokenType>
+
+inline std::size_t countDataRowsRespectingQuotes(const blDataIteratorType& beginIter,
+                                                 const blDataIteratorType& endIter,
+                                                 const blTokenIteratorType& rowTokensBeginIter,
+                                                 const blTokenIteratorType& rowTokensEndIter,
+                                                 const bool& shouldZeroLengthRowsBeCounted,
+                                                 const blQuoteTokenType& quoteToken)
+{
+    std::size_t totalNumberOfRows = std::size_t(0);
+
+    auto countRow = [&totalNumberOfRows](const blDataIteratorType&,const blDataIteratorType&)
+    {
+        ++totalNumberOfRows;
+        return true;
+    };
+
+    forEachDataPointRespectingQuotes(beginIter,
+                                     endIter,
+                                     rowTokensBeginIter,
+                                     rowTokensEndIter,
+                                     shouldZeroLengthRowsBeCounted,
+                                     quoteToken,
+                                     countRow);
+
+    return totalNumberOfRows;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Quote-aware version of "findOffsetsOfAllDataRows"
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blTokenIteratorType,
+         typename blQuoteTokenType,
+         typename blOffsetContainerType>
+
+inline std::size_t findOffsetsOfAllDataRowsRespectingQuotes(const blDataIteratorType& beginIter,
+                                                            const blDataIteratorType& endIter,
+                                                            const blTokenIteratorType& rowTokensBeginIter,
+                                                            const blTokenIteratorType& rowTokensEndIter,
+                                                            const bool& shouldZeroLengthRowsBeCounted,
+                                                            const blQuoteTokenType& quoteToken,
+                                                            const blDataIteratorType& offsetOriginIter,
+                                                            blOffsetContainerType& rowOffsets)
+{
+    std::size_t totalNumberOfRows = std::size_t(0);
+
+    auto recordRow = [&totalNumberOfRows,&offsetOriginIter,&rowOffsets](const blDataIteratorType& rowBeginIter,const blDataIteratorType&)
+    {
+        rowOffsets.push_back(std::distance(offsetOriginIter,rowBeginIter));
+        ++totalNumberOfRows;
+        return true;
+    };
+
+    forEachDataPointRespectingQuotes(beginIter,
+                                     endIter,
+                                     rowTokensBeginIter,
+                                     rowTokensEndIter,
+                                     shouldZeroLengthRowsBeCounted,
+                                     quoteToken,
+                                     recordRow);
+
+    return totalNumberOfRows;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Quote-aware version of "findBeginAndEndOfNthDataPoint"
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blTokenIteratorType,
+         typename blQuoteTokenType,
+         typename blIntegerType>
+
+inline blIntegerType findBeginAndEndOfNthDataPointRespectingQuotes(const blDataIteratorType& dataBeginIter,
+                                                                   const blDataIteratorType& dataEndIter,
+                                                                   const blTokenIteratorType& tokenListBeginIter,
+                                                                   const blTokenIteratorType& tokenListEndIter,
+                                                                   const bool& shouldZeroLengthRowsBeCounted,
+                                                                   const blQuoteTokenType& quoteToken,
+                                                                   const blIntegerType& whichDataPointToFind,
+                                                                   blDataIteratorType& nthDataPointBeginIter,
+                                                                   blDataIteratorType& nthDataPointEndIter)
+{
+    // We copy the inputs since the
+    // output iterators could be
+    // one of them
+
+    blDataIteratorType beginIter = dataBeginIter;
+    blDataIteratorType endIter = dataEndIter;
+
+    nthDataPointBeginIter = beginIter;
+    nthDataPointEndIter = beginIter;
+
+    blIntegerType currentDataPoint = blIntegerType(-1);
+
+    if(whichDataPointToFind < blIntegerType(0))
+        return currentDataPoint;
+
+
+
+    auto findNthDataPoint = [&](const blDataIteratorType& dataPointBeginIter,const blDataIteratorType& dataPointEndIter)
+    {
+        ++currentDataPoint;
+
+        nthDataPointBeginIter = dataPointBeginIter;
+        nthDataPointEndIter = dataPointEndIter;
+
+        return (currentDataPoint < whichDataPointToFind);
+    };
+
+    forEachDataPointRespectingQuotes(beginIter,
+                                     endIter,
+                                     tokenListBeginIter,
+                                     tokenListEndIter,
+                                     shouldZeroLengthRowsBeCounted,
+                                     quoteToken,
+                                     findNthDataPoint);
+
+    return currentDataPoint;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Quote-aware version of "findBeginningOfNthDataPoint"
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blTokenIteratorType,
+         typename blQuoteTokenType,
+         typename blIntegerType>
+
+inline blIntegerType findBeginningOfNthDataPointRespectingQuotes(const blDataIteratorType& dataBeginIter,
+                                                                 const blDataIteratorType& dataEndIter,
+                                                                 const blTokenIteratorType& tokenListBeginIter,
+                                                                 const blTokenIteratorType& tokenListEndIter,
+                                                                 const bool& shouldZeroLengthRowsBeCounted,
+                                                                 const blQuoteTokenType& quoteToken,
+                                                                 const blIntegerType& whichDataPointToFind,
+                                                                 blDataIteratorType& nthDataPointBeginIter)
+{
+    blDataIteratorType nthDataPointEndIter = dataBeginIter;
+
+    return findBeginAndEndOfNthDataPointRespectingQuotes(dataBeginIter,
+                                                         dataEndIter,
+                                                         tokenListBeginIter,
+                                                         tokenListEndIter,
+                                                         shouldZeroLengthRowsBeCounted,
+                                                         quoteToken,
+                                                         whichDataPointToFind,
+                                                         nthDataPointBeginIter,
+                                                         nthDataPointEndIter);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Quote-aware version of "findOffsetsOfEveryNthDataPoint"
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blTokenIteratorType,
+         typename blQuoteTokenType,
+         typename blIntegerType,
+         typename blOffsetContainerType>
+
+inline blIntegerType findOffsetsOfEveryNthDataPointRespectingQuotes(const blDataIteratorType& dataBeginIter,
+                                                                    const blDataIteratorType& dataEndIter,
+                                                                    const blTokenIteratorType& tokenListBeginIter,
+                                                                    const blTokenIteratorType& tokenListEndIter,
+                                                                    const bool& shouldZeroLengthRowsBeCounted,
+                                                                    const blQuoteTokenType& quoteToken,
+                                                                    const blIntegerType& intervalBetweenRecordedDataPoints,
+                                                                    const blDataIteratorType& offsetOriginIter,
+                                                                    blOffsetContainerType& dataPointOffsets)
+{
+    blIntegerType totalNumberOfDataPoints = blIntegerType(0);
+
+    if(intervalBetweenRecordedDataPoints <= blIntegerType(0))
+        return totalNumberOfDataPoints;
+
+    auto recordDataPoint = [&](const blDataIteratorType& dataPointBeginIter,const blDataIteratorType&)
+    {
+        if(totalNumberOfDataPoints % intervalBetweenRecordedDataPoints == blIntegerType(0))
+            dataPointOffsets.push_back(std::distance(offsetOriginIter,dataPointBeginIter));
+
+        ++totalNumberOfDataPoints;
+
+        return true;
+    };
+
+    forEachDataPointRespectingQuotes(dataBeginIter,
+                                     dataEndIter,
+                                     tokenListBeginIter,
+                                     tokenListEndIter,
+                                     shouldZeroLengthRowsBeCounted,
+                                     quoteToken,
+                                     recordDataPoint);
+
+    return totalNumberOfDataPoints;
+}
+//-------------------------------------------------------------------
+
+
+
 //-------------------------------------------------------------------
 // This function gets an iterator to a data
 // point in the data array corresponding to
@@ -0,0 +1,376 @@
+#ifndef BL_DATAFINGERPRINT_HPP
+#define BL_DATAFINGERPRINT_HPP
+
+
+
+//-------------------------------------------------------------------
+// FILE:            blDataFingerprint.hpp
+//
+//
+//
+// PURPOSE:         Functions used to hash data, so that something
+//                  computed from the data (for ex. an index or a
+//                  cache saved to a file) can later be checked
+//                  against it
+//
+//                  -- hashBytes hashes all the bytes of a range
+//                     (FNV-1a, 64 bits)
+//
+//                  -- computeDataFingerprint hashes the length of a
+//                     range and (at most) three 64KB blocks of it (its
+//                     beginning, middle and end), so that it costs the
+//                     same no matter how big the data is
+//
+//                     NOTE:  A change that keeps the length of the data
+//                            and only touches bytes outside of the three
+//                            blocks is not detected, which is why the
+//                            fingerprint is meant to be combined with
+//                            other checks (for ex. a file's modification
+//                            time, as blCSVBinaryCache does) when that
+//                            matters
+//
+//                  -- computeFullDataFingerprint hashes the length and
+//                     every byte of a range, eight bytes at a time over
+//                     four independent lanes (a char buffer is read a
+//                     word at a time), it's what the indexes of the csv
+//                     and text iterators are checked against, since
+//                     they don't know which file (if any) the data
+//                     came from
+//
+//                  -- getFileSizeAndModificationTime gets the size and
+//                     modification time of a file (_stat64 on windows,
+//                     stat elsewhere)
+//
+//                  -- All functions are defined within the
+//                     "blAlgorithmsLIB" namespace
+//
+//
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+//
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Includes needed for this file
+//-------------------------------------------------------------------
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <algorithm>
+#include <string>
+#include <cstring>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#if defined(_WIN32)
+#define BL_ALGORITHMSLIB_DATAFINGERPRINT_USE_WIN32
+#endif
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// NOTE: This class is defined within the blAlgorithmsLIB namespace
+//-------------------------------------------------------------------
+namespace blAlgorithmsLIB
+{
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Initial value of the hashes computed below
+//-------------------------------------------------------------------
+const std::uint64_t BL_INITIAL_HASH = 14695981039346656037ull;
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to hash all the bytes of a range (FNV-1a)
+//-------------------------------------------------------------------
+template<typename blDataIteratorType>
+
+inline void hashBytes(const blDataIteratorType& beginIter,
+                      const blDataIteratorType& endIter,
+                      std::uint64_t& hash)
+{
+    for(auto currentIter = beginIter; currentIter != endIter; ++currentIter)
+    {
+        hash ^= static_cast<unsigned char>(*currentIter);
+        hash *= 1099511628211ull;
+    }
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to hash the eight bytes of a value
+//-------------------------------------------------------------------
+inline void hashValue(const std::uint64_t& value,
+                      std::uint64_t& hash)
+{
+    for(int i = 0; i < 8; ++i)
+    {
+        hash ^= static_cast<unsigned char>(value >> (8 * i));
+        hash *= 1099511628211ull;
+    }
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to fingerprint a range from its length
+// and (at most) three blocks of it
+//-------------------------------------------------------------------
+template<typename blDataIteratorType>
+
+inline std::uint64_t computeDataFingerprint(const blDataIteratorType& beginIter,
+                                            const blDataIteratorType& endIter)
+{
+    const std::ptrdiff_t blockLength = 1 << 16;
+
+    std::ptrdiff_t dataLength = std::distance(beginIter,endIter);
+
+    std::uint64_t hash = BL_INITIAL_HASH;
+
+    hashValue(static_cast<std::uint64_t>(dataLength),hash);
+
+
+
+    std::ptrdiff_t blockOffsets[3] = {0,
+                                      dataLength / 2,
+                                      std::max(dataLength - blockLength,std::ptrdiff_t(0))};
+
+    for(const auto& blockOffset : blockOffsets)
+    {
+        auto blockBeginIter = beginIter;
+        std::advance(blockBeginIter,blockOffset);
+
+        auto blockEndIter = blockBeginIter;
+        std::advance(blockEndIter,std::min(blockLength,dataLength - blockOffset));
+
+        hashBytes(blockBeginIter,blockEndIter,hash);
+    }
+
+    return hash;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used to mix an eight bytes word into a lane
+// of the full fingerprint and to combine the lanes, the
+// trailing bytes (less than eight) and the length into
+// the fingerprint
+//-------------------------------------------------------------------
+inline void mixWordIntoLane(const std::uint64_t& word,
+                            std::uint64_t& lane)
+{
+    lane ^= word;
+    lane *= 0x9E3779B97F4A7C15ull;
+    lane ^= (lane >> 32);
+}
+
+
+
+inline std::uint64_t combineFullDataFingerprint(const std::uint64_t (&lanes)[4],
+                                                const std::uint64_t& trailingWord,
+                                                const std::uint64_t& length)
+{
+    std::uint64_t hash = BL_INITIAL_HASH;
+
+    hashValue(length,hash);
+
+    for(const auto& lane : lanes)
+        hashValue(lane,hash);
+
+    hashValue(trailingWord,hash);
+
+    return hash;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used to fingerprint a range from its length
+// and all of its bytes (read as little endian words, so
+// that any kind of iterator over the same bytes gets
+// the same fingerprint)
+//-------------------------------------------------------------------
+template<typename blDataIteratorType>
+
+inline std::uint64_t computeFullDataFingerprint(const blDataIteratorType& beginIter,
+                                                const blDataIteratorType& endIter)
+{
+    std::uint64_t lanes[4] = {1,2,3,4};
+
+    std::uint64_t length = 0;
+    std::uint64_t word = 0;
+
+    for(auto currentIter = beginIter; currentIter != endIter; ++currentIter)
+    {
+        word |= static_cast<std::uint64_t>(static_cast<unsigned char>(*currentIter)) << (8 * (length % 8));
+
+        ++length;
+
+        if(length % 8 == 0)
+        {
+            mixWordIntoLane(word,lanes[(length / 8 - 1) % 4]);
+            word = 0;
+        }
+    }
+
+    return combineFullDataFingerprint(lanes,word,length);
+}
+
+
+
+inline std::uint64_t computeFullDataFingerprint(const char* beginIter,
+                                                const char* endIter)
+{
+    std::uint64_t lanes[4] = {1,2,3,4};
+
+    std::uint64_t length = static_cast<std::uint64_t>(endIter - beginIter);
+
+    const unsigned char* currentIter = reinterpret_cast<const unsigned char*>(beginIter);
+
+    // The words are read as little
+    // endian ones on any machine
+
+    const std::uint16_t endianessTest = 1;
+    const bool isMachineBigEndian = ((*reinterpret_cast<const unsigned char*>(&endianessTest)) == 0);
+
+    auto readWord = [isMachineBigEndian](const unsigned char* bytes)
+    {
+        std::uint64_t word = 0;
+
+        if(isMachineBigEndian)
+        {
+            for(int i = 0; i < 8; ++i)
+                word |= static_cast<std::uint64_t>(bytes[i]) << (8 * i);
+        }
+        else
+        {
+            std::memcpy(&word,bytes,sizeof(word));
+        }
+
+        return word;
+    };
+
+
+
+    // We mix four words at a time,
+    // one in each lane
+
+    std::uint64_t numberOfWords = length / 8;
+    std::uint64_t wordIndex = 0;
+
+    for(; wordIndex + 4 <= numberOfWords; wordIndex += 4, currentIter += 32)
+    {
+        mixWordIntoLane(readWord(currentIter),lanes[0]);
+        mixWordIntoLane(readWord(currentIter + 8),lanes[1]);
+        mixWordIntoLane(readWord(currentIter + 16),lanes[2]);
+        mixWordIntoLane(readWord(currentIter + 24),lanes[3]);
+    }
+
+    for(; wordIndex < numberOfWords; ++wordIndex, currentIter += 8)
+        mixWordIntoLane(readWord(currentIter),lanes[wordIndex % 4]);
+
+
+
+    std::uint64_t trailingWord = 0;
+
+    for(std::uint64_t i = 0; i < length % 8; ++i)
+        trailingWord |= static_cast<std::uint64_t>(currentIter[i]) << (8 * i);
+
+    return combineFullDataFingerprint(lanes,trailingWord,length);
+}
+
+
+
+inline std::uint64_t computeFullDataFingerprint(char* beginIter,
+                                                char* endIter)
+{
+    return computeFullDataFingerprint(static_cast<const char*>(beginIter),
+                                      static_cast<const char*>(endIter));
+}
+
+
+
+inline std::uint64_t computeFullDataFingerprint(const std::string::const_iterator& beginIter,
+                                                const std::string::const_iterator& endIter)
+{
+    if(beginIter == endIter)
+        return computeFullDataFingerprint(static_cast<const char*>(nullptr),static_cast<const char*>(nullptr));
+
+    return computeFullDataFingerprint(&(*beginIter),&(*beginIter) + (endIter - beginIter));
+}
+
+
+
+inline std::uint64_t computeFullDataFingerprint(const std::string::iterator& beginIter,
+                                                const std::string::iterator& endIter)
+{
+    return computeFullDataFingerprint(std::string::const_iterator(beginIter),
+                                      std::string::const_iterator(endIter));
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to get the size and modification time
+// (in seconds) of a file, it returns false if the file
+// could not be looked at
+//-------------------------------------------------------------------
+inline bool getFileSizeAndModificationTime(const std::string& filePath,
+                                           std::uint64_t& fileSize,
+                                           std::uint64_t& fileModificationTime)
+{
+#if defined(BL_ALGORITHMSLIB_DATAFINGERPRINT_USE_WIN32)
+
+    struct _stat64 fileStatus;
+
+    if(::_stat64(filePath.c_str(),&fileStatus) != 0)
+        return false;
+
+#else
+
+    struct stat fileStatus;
+
+    if(::stat(filePath.c_str(),&fileStatus) != 0)
+        return false;
+
+#endif
+
+    fileSize = static_cast<std::uint64_t>(fileStatus.st_size);
+    fileModificationTime = static_cast<std::uint64_t>(fileStatus.st_mtime);
+
+    return true;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// End of namespace
+}
+//-------------------------------------------------------------------
+
+
+
+#endif // BL_DATAFINGERPRINT_HPP
@@ -0,0 +1,929 @@
+#ifndef BL_DECOMPRESSINGSOURCE_HPP
+#define BL_DECOMPRESSINGSOURCE_HPP
+
+
+
+//-------------------------------------------------------------------
+// FILE:            blDecompressingSource.hpp
+// CLASS:           blDecompressingSource
+// BASE CLASS:      None
+//
+//
+//
+// PURPOSE:         A class that streams the decompressed contents of a
+//                  (gzip or zstd) compressed file, so that compressed
+//                  csv/text archives can be parsed without first being
+//                  decompressed to disk or into one big string
+//
+//                  -- The file is decompressed on a separate thread, one
+//                     block at a time, into a bounded queue of blocks, so
+//                     that decompressing the next blocks overlaps with
+//                     parsing the current one, and so that the memory used
+//                     never grows beyond a few blocks no matter how big
+//                     the file is
+//
+//                  -- The decompressed data is read in chunks of whole
+//                     rows (a chunk ends right after the last row token
+//                     found in a block, the rest of the block is carried
+//                     over to the next chunk), and each chunk can be
+//                     handed straight to the iterators of this library,
+//                     for example:
+//
+//                     blDecompressingSource source("data.csv.gz");
+//
+//                     std::string chunk;
+//
+//                     while(source.readChunk(chunk))
+//                     {
+//                         blCSVMatrixIterator<const char*,double> iter(chunk.data(),
+//                                                                      chunk.data() + chunk.size());
+//
+//                         ...
+//                     }
+//
+//                     NOTE:  Only the first chunk has the title row (if
+//                            the csv data has one), and a quoted field
+//                            holding a row token can be split between
+//                            two chunks
+//
+//                  -- The compression format is detected from the first
+//                     bytes of the file, files that are not compressed
+//                     are simply read (still on a separate thread)
+//
+//                  -- gzip files are decompressed with zlib and zstd files
+//                     with libzstd, both are optional and only used when
+//                     BL_ALGORITHMSLIB_USE_ZLIB and/or BL_ALGORITHMSLIB_USE_ZSTD
+//                     are defined before including this file (the program
+//                     then has to be linked with -lz and/or -lzstd)
+//
+//                  -- This class and its functions are defined within
+//                     the "blAlgorithmsLIB" namespace
+//
+//
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+//
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Includes needed for this file
+//-------------------------------------------------------------------
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <algorithm>
+#include <vector>
+#include <deque>
+#include <fstream>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#if defined(BL_ALGORITHMSLIB_USE_ZLIB)
+#include <zlib.h>
+#endif
+
+#if defined(BL_ALGORITHMSLIB_USE_ZSTD)
+#include <zstd.h>
+#endif
+
+#include "blEnumsAndConstants.hpp"
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// NOTE: This class is defined within the blAlgorithmsLIB namespace
+//-------------------------------------------------------------------
+namespace blAlgorithmsLIB
+{
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+class blDecompressingSource
+{
+public: // Constructors and destructor
+
+
+
+    // Default constructor (no
+    // file opened)
+
+    blDecompressingSource();
+
+
+
+    // Constructor that opens the specified
+    // file and starts decompressing it
+
+    blDecompressingSource(const std::string& filePath,
+                          const blCompressionFormat& compressionFormat = AUTO_DETECT_COMPRESSION,
+                          const std::size_t& blockSize = 1 << 20,
+                          const std::size_t& maxNumberOfQueuedBlocks = 4);
+
+
+
+    // The decompressing thread works on
+    // this object, so it can be neither
+    // copied nor moved
+
+    blDecompressingSource(const blDecompressingSource& decompressingSource) = delete;
+
+
+
+    // Destructor
+
+    ~blDecompressingSource();
+
+
+
+public: // Assignment operators
+
+
+
+    blDecompressingSource&                                              operator=(const blDecompressingSource& decompressingSource) = delete;
+
+
+
+public: // Public functions
+
+
+
+    // Functions used to open/close a file
+    // The open function returns false if
+    // the file could not be opened or if
+    // its compression format is not
+    // supported by this build
+    // Closing the file stops the
+    // decompressing thread
+
+    bool                                                                open(const std::string& filePath,
+                                                                             const blCompressionFormat& compressionFormat = AUTO_DETECT_COMPRESSION,
+                                                                             const std::size_t& blockSize = 1 << 20,
+                                                                             const std::size_t& maxNumberOfQueuedBlocks = 4);
+
+    void                                                                close();
+
+
+
+    // Function used to read the next chunk
+    // of whole rows of the decompressed data,
+    // it waits for the decompressing thread
+    // when no block is ready yet
+    // It returns false when all the data
+    // has been read
+    //
+    // NOTE:  The last chunk might not end
+    //        with a row token, and a row longer
+    //        than a block makes its chunk span
+    //        multiple blocks
+
+    bool                                                                readChunk(std::string& chunk,
+                                                                                  const std::string& rowTokens = "\r\n");
+
+
+
+    // Function used to read the next block
+    // of decompressed data as is (cut at
+    // any byte)
+    // It returns false when all the data
+    // has been read
+
+    bool                                                                readBlock(std::string& block);
+
+
+
+    // Functions used to get
+    // info about the source
+
+    bool                                                                isOpen()const;
+
+    const std::string&                                                  getFilePath()const;
+    const blCompressionFormat&                                          getCompressionFormat()const;
+
+
+
+    // Function used to check whether the
+    // decompression failed (for ex. corrupted
+    // or truncated data), in which case the
+    // data read so far is all there is
+
+    bool                                                                hasFailed()const;
+
+
+
+protected: // Protected functions
+
+
+
+    // Function used to detect the
+    // compression format of the file
+    // from its first bytes
+
+    blCompressionFormat                                                 detectCompressionFormat();
+
+
+
+    // Function run by the decompressing
+    // thread, and the functions it uses
+    // for each compression format
+    // They return false when the data
+    // could not be decompressed
+
+    void                                                                decompressFile();
+
+    bool                                                                copyFile();
+    bool                                                                inflateGzipFile();
+    bool                                                                decompressZstdFile();
+
+
+
+    // Function used by the decompressing
+    // thread to queue a block, waiting while
+    // the queue is full
+    // It returns false when the thread
+    // has been asked to stop
+
+    bool                                                                queueBlock(std::string& block);
+
+
+
+private: // Static functions/variables/constants
+
+
+
+    // Size of the buffer used to
+    // read the compressed data
+
+    static const std::size_t                                            s_inputBufferSize = 1 << 16;
+
+
+
+protected: // Protected variables
+
+
+
+    // The path of the file, its
+    // compression format and the
+    // file itself (only read by the
+    // decompressing thread)
+
+    std::string                                                         m_filePath;
+
+    blCompressionFormat                                                 m_compressionFormat;
+
+    std::ifstream                                                       m_file;
+
+
+
+    // Flag telling us whether
+    // a file is opened
+
+    bool                                                                m_isOpen;
+
+
+
+    // Size of a block and maximum number
+    // of blocks waiting to be read
+
+    std::size_t                                                         m_blockSize;
+    std::size_t                                                         m_maxNumberOfQueuedBlocks;
+
+
+
+    // The decompressing thread, the queue
+    // of decompressed blocks and the flags
+    // shared with the thread (all guarded
+    // by the mutex)
+
+    std::thread                                                         m_decompressingThread;
+
+    mutable std::mutex                                                  m_queueMutex;
+    std::condition_variable                                             m_queueCondition;
+
+    std::deque<std::string>                                             m_queuedBlocks;
+
+    bool                                                                m_isDecompressionFinished;
+    bool                                                                m_shouldDecompressionStop;
+    bool                                                                m_hasFailed;
+
+
+
+    // The last block read and the
+    // (partial) row carried over to
+    // the next chunk
+
+    std::string                                                         m_block;
+    std::string                                                         m_partialRow;
+};
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Constructors and destructor
+//-------------------------------------------------------------------
+inline blDecompressingSource::blDecompressingSource()
+{
+    m_compressionFormat = NO_COMPRESSION;
+    m_isOpen = false;
+    m_blockSize = 1 << 20;
+    m_maxNumberOfQueuedBlocks = 4;
+    m_isDecompressionFinished = true;
+    m_shouldDecompressionStop = false;
+    m_hasFailed = false;
+}
+
+
+
+inline blDecompressingSource::blDecompressingSource(const std::string& filePath,
+                                                    const blCompressionFormat& compressionFormat,
+                                                    const std::size_t& blockSize,
+                                                    const std::size_t& maxNumberOfQueuedBlocks) : blDecompressingSource()
+{
+    open(filePath,compressionFormat,blockSize,maxNumberOfQueuedBlocks);
+}
+
+
+
+inline blDecompressingSource::~blDecompressingSource()
+{
+    close();
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to open a file and start decompressing it
+//-------------------------------------------------------------------
+inline bool blDecompressingSource::open(const std::string& filePath,
+                                        const blCompressionFormat& compressionFormat,
+                                        const std::size_t& blockSize,
+                                        const std::size_t& maxNumberOfQueuedBlocks)
+{
+    close();
+
+    m_file.open(filePath.c_str(),std::ios::in | std::ios::binary);
+
+    if(!m_file.is_open())
+        return false;
+
+    m_compressionFormat = compressionFormat;
+
+    if(m_compressionFormat == AUTO_DETECT_COMPRESSION)
+        m_compressionFormat = detectCompressionFormat();
+
+
+
+    // A compression format this build
+    // can't decompress is not supported
+
+#if !defined(BL_ALGORITHMSLIB_USE_ZLIB)
+
+    if(m_compressionFormat == GZIP_COMPRESSION)
+    {
+        m_file.close();
+        return false;
+    }
+
+#endif
+
+#if !defined(BL_ALGORITHMSLIB_USE_ZSTD)
+
+    if(m_compressionFormat == ZSTD_COMPRESSION)
+    {
+        m_file.close();
+        return false;
+    }
+
+#endif
+
+
+
+    m_filePath = filePath;
+    m_blockSize = std::max(blockSize,std::size_t(1));
+    m_maxNumberOfQueuedBlocks = std::max(maxNumberOfQueuedBlocks,std::size_t(1));
+
+    m_isDecompressionFinished = false;
+    m_shouldDecompressionStop = false;
+    m_hasFailed = false;
+
+    m_isOpen = true;
+
+    m_decompressingThread = std::thread(&blDecompressingSource::decompressFile,this);
+
+    return true;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to close the file
+//-------------------------------------------------------------------
+inline void blDecompressingSource::close()
+{
+    if(m_decompressingThread.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_queueMutex);
+            m_shouldDecompressionStop = true;
+        }
+
+        m_queueCondition.notify_all();
+
+        m_decompressingThread.join();
+    }
+
+    if(m_file.is_open())
+        m_file.close();
+
+    m_file.clear();
+
+    m_filePath.clear();
+    m_queuedBlocks.clear();
+    m_block.clear();
+    m_partialRow.clear();
+
+    m_compressionFormat = NO_COMPRESSION;
+    m_isDecompressionFinished = true;
+    m_shouldDecompressionStop = false;
+    m_hasFailed = false;
+    m_isOpen = false;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to detect the compression format of the file
+//-------------------------------------------------------------------
+inline blCompressionFormat blDecompressingSource::detectCompressionFormat()
+{
+    unsigned char magicNumber[4] = {0,0,0,0};
+
+    m_file.read(reinterpret_cast<char*>(magicNumber),4);
+
+    std::streamsize numberOfBytesRead = m_file.gcount();
+
+    m_file.clear();
+    m_file.seekg(0,std::ios::beg);
+
+
+
+    if(numberOfBytesRead >= 2 &&
+       magicNumber[0] == 0x1F &&
+       magicNumber[1] == 0x8B)
+    {
+        return GZIP_COMPRESSION;
+    }
+
+    if(numberOfBytesRead >= 4 &&
+       magicNumber[0] == 0x28 &&
+       magicNumber[1] == 0xB5 &&
+       magicNumber[2] == 0x2F &&
+       magicNumber[3] == 0xFD)
+    {
+        return ZSTD_COMPRESSION;
+    }
+
+    return NO_COMPRESSION;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used to read the decompressed data
+//-------------------------------------------------------------------
+inline bool blDecompressingSource::readChunk(std::string& chunk,
+                                             const std::string& rowTokens)
+{
+    chunk.swap(m_partialRow);
+    m_partialRow.clear();
+
+    while(readBlock(m_block))
+    {
+        std::size_t lastRowTokenPosition = m_block.find_last_of(rowTokens);
+
+        if(lastRowTokenPosition == std::string::npos)
+        {
+            chunk.append(m_block);
+            continue;
+        }
+
+        chunk.append(m_block,0,lastRowTokenPosition + 1);
+        m_partialRow.assign(m_block,lastRowTokenPosition + 1,std::string::npos);
+
+        return true;
+    }
+
+
+
+    // The last row of the data
+    // might not end with a row token
+
+    return !chunk.empty();
+}
+
+
+
+inline bool blDecompressingSource::readBlock(std::string& block)
+{
+    if(!m_isOpen)
+        return false;
+
+    std::unique_lock<std::mutex> lock(m_queueMutex);
+
+    m_queueCondition.wait(lock,[this](){return (!m_queuedBlocks.empty() || m_isDecompressionFinished);});
+
+    if(m_queuedBlocks.empty())
+        return false;
+
+    block.swap(m_queuedBlocks.front());
+    m_queuedBlocks.pop_front();
+
+    lock.unlock();
+
+    m_queueCondition.notify_all();
+
+    return true;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used to get info about the source
+//-------------------------------------------------------------------
+inline bool blDecompressingSource::isOpen()const
+{
+    return m_isOpen;
+}
+
+
+
+inline const std::string& blDecompressingSource::getFilePath()const
+{
+    return m_filePath;
+}
+
+
+
+inline const blCompressionFormat& blDecompressingSource::getCompressionFormat()const
+{
+    return m_compressionFormat;
+}
+
+
+
+inline bool blDecompressingSource::hasFailed()const
+{
+    std::lock_guard<std::mutex> lock(m_queueMutex);
+
+    return m_hasFailed;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function run by the decompressing thread
+//-------------------------------------------------------------------
+inline void blDecompressingSource::decompressFile()
+{
+    bool wasDecompressionSuccessful = false;
+
+    switch(m_compressionFormat)
+    {
+    case GZIP_COMPRESSION:
+        wasDecompressionSuccessful = inflateGzipFile();
+        break;
+
+    case ZSTD_COMPRESSION:
+        wasDecompressionSuccessful = decompressZstdFile();
+        break;
+
+    default:
+        wasDecompressionSuccessful = copyFile();
+        break;
+    }
+
+
+
+    {
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+
+        m_hasFailed = !wasDecompressionSuccessful;
+        m_isDecompressionFinished = true;
+    }
+
+    m_queueCondition.notify_all();
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to queue a decompressed block
+//-------------------------------------------------------------------
+inline bool blDecompressingSource::queueBlock(std::string& block)
+{
+    std::unique_lock<std::mutex> lock(m_queueMutex);
+
+    m_queueCondition.wait(lock,[this](){return (m_shouldDecompressionStop || m_queuedBlocks.size() < m_maxNumberOfQueuedBlocks);});
+
+    if(m_shouldDecompressionStop)
+        return false;
+
+    m_queuedBlocks.push_back(std::string());
+    m_queuedBlocks.back().swap(block);
+
+    lock.unlock();
+
+    m_queueCondition.notify_all();
+
+    return true;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to read a file that is not compressed
+//-------------------------------------------------------------------
+inline bool blDecompressingSource::copyFile()
+{
+    std::string block;
+
+    while(true)
+    {
+        block.resize(m_blockSize);
+
+        m_file.read(&block[0],static_cast<std::streamsize>(m_blockSize));
+
+        block.resize(static_cast<std::size_t>(m_file.gcount()));
+
+        if(block.empty())
+            break;
+
+        if(!queueBlock(block))
+            return true;
+    }
+
+    return !m_file.bad();
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to decompress a gzip file
+//-------------------------------------------------------------------
+inline bool blDecompressingSource::inflateGzipFile()
+{
+#if defined(BL_ALGORITHMSLIB_USE_ZLIB)
+
+    z_stream stream;
+    std::memset(&stream,0,sizeof(stream));
+
+    // A window of 15 bits plus 32 lets
+    // zlib accept both gzip and zlib
+    // headers
+
+    if(inflateInit2(&stream,15 + 32) != Z_OK)
+        return false;
+
+
+
+    std::vector<char> input(s_inputBufferSize);
+
+    std::string block(m_blockSize,'\0');
+
+    stream.next_out = reinterpret_cast<Bytef*>(&block[0]);
+    stream.avail_out = static_cast<uInt>(m_blockSize);
+
+    bool isInputFinished = false;
+    bool hasStreamEnded = false;
+    bool wasDecompressionSuccessful = true;
+
+    while(true)
+    {
+        if(stream.avail_in == 0 && !isInputFinished)
+        {
+            m_file.read(input.data(),static_cast<std::streamsize>(input.size()));
+
+            stream.next_in = reinterpret_cast<Bytef*>(input.data());
+            stream.avail_in = static_cast<uInt>(m_file.gcount());
+
+            if(stream.avail_in == 0)
+                isInputFinished = true;
+        }
+
+
+
+        // A gzip file can be made of multiple
+        // members one after the other, so we
+        // keep going while there is input
+
+        if(hasStreamEnded)
+        {
+            if(stream.avail_in == 0)
+            {
+                if(isInputFinished)
+                    break;
+                else
+                    continue;
+            }
+
+            inflateReset(&stream);
+            hasStreamEnded = false;
+        }
+
+        int result = inflate(&stream,Z_NO_FLUSH);
+
+        if(result == Z_STREAM_END)
+        {
+            hasStreamEnded = true;
+        }
+        else if(result != Z_OK && result != Z_BUF_ERROR)
+        {
+            wasDecompressionSuccessful = false;
+            break;
+        }
+
+
+
+        // When the block is full there
+        // might be more output pending
+        // even if the input is finished
+
+        if(stream.avail_out == 0)
+        {
+            if(!queueBlock(block))
+            {
+                inflateEnd(&stream);
+                return true;
+            }
+
+            block.assign(m_blockSize,'\0');
+
+            stream.next_out = reinterpret_cast<Bytef*>(&block[0]);
+            stream.avail_out = static_cast<uInt>(m_blockSize);
+        }
+        else if(isInputFinished)
+        {
+            break;
+        }
+    }
+
+    block.resize(m_blockSize - stream.avail_out);
+
+    inflateEnd(&stream);
+
+    if(!block.empty() && !queueBlock(block))
+        return true;
+
+
+
+    // A truncated file is a failure
+
+    return (wasDecompressionSuccessful && hasStreamEnded && !m_file.bad());
+
+#else
+
+    return false;
+
+#endif
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to decompress a zstd file
+//-------------------------------------------------------------------
+inline bool blDecompressingSource::decompressZstdFile()
+{
+#if defined(BL_ALGORITHMSLIB_USE_ZSTD)
+
+    ZSTD_DStream* stream = ZSTD_createDStream();
+
+    if(stream == nullptr)
+        return false;
+
+    ZSTD_initDStream(stream);
+
+
+
+    std::vector<char> input(s_inputBufferSize);
+
+    std::string block(m_blockSize,'\0');
+
+    ZSTD_inBuffer inputBuffer = {input.data(),0,0};
+    ZSTD_outBuffer outputBuffer = {&block[0],m_blockSize,0};
+
+    // A frame is completed when the result
+    // is zero, after that a call without
+    // input starts waiting for a new frame
+
+    bool hasFrameEnded = false;
+
+    bool isInputFinished = false;
+    bool wasDecompressionSuccessful = true;
+
+    while(true)
+    {
+        if(inputBuffer.pos == inputBuffer.size && !isInputFinished)
+        {
+            m_file.read(input.data(),static_cast<std::streamsize>(input.size()));
+
+            inputBuffer.size = static_cast<std::size_t>(m_file.gcount());
+            inputBuffer.pos = 0;
+
+            if(inputBuffer.size == 0)
+                isInputFinished = true;
+        }
+
+        std::size_t previousInputPosition = inputBuffer.pos;
+
+        std::size_t result = ZSTD_decompressStream(stream,&outputBuffer,&inputBuffer);
+
+        if(ZSTD_isError(result))
+        {
+            wasDecompressionSuccessful = false;
+            break;
+        }
+
+        if(result == 0)
+            hasFrameEnded = true;
+        else if(inputBuffer.pos != previousInputPosition)
+            hasFrameEnded = false;
+
+
+
+        // When the block is full there
+        // might be more output pending
+        // even if the input is finished
+
+        if(outputBuffer.pos == outputBuffer.size)
+        {
+            if(!queueBlock(block))
+            {
+                ZSTD_freeDStream(stream);
+                return true;
+            }
+
+            block.assign(m_blockSize,'\0');
+
+            outputBuffer.dst = &block[0];
+            outputBuffer.pos = 0;
+        }
+        else if(isInputFinished)
+        {
+            break;
+        }
+    }
+
+    block.resize(outputBuffer.pos);
+
+    ZSTD_freeDStream(stream);
+
+    if(!block.empty() && !queueBlock(block))
+        return true;
+
+
+
+    // A truncated file is a failure
+
+    return (wasDecompressionSuccessful && hasFrameEnded && !m_file.bad());
+
+#else
+
+    return false;
+
+#endif
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// End of namespace
+}
+//-------------------------------------------------------------------
+
+
+
+#endif // BL_DECOMPRESSINGSOURCE_HPP
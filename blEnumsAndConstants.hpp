@@ -25,6 +25,42 @@ enum blAdvancingIteratorMethod {COL_MAJOR = 0,
 
 
 
+//-------------------------------------------------------------------
+// Enum used to hint the operating system about how
+// memory-mapped data is going to be accessed
+//-------------------------------------------------------------------
+enum blMemoryAccessHint {NORMAL_ACCESS = 0,
+                         SEQUENTIAL_ACCESS = 1,
+                         RANDOM_ACCESS = 2};
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Enum used to describe the type in which the values
+// of a csv column are parsed and stored
+//-------------------------------------------------------------------
+enum blColumnType {INT32_COLUMN = 0,
+                   INT64_COLUMN = 1,
+                   FLOAT_COLUMN = 2,
+                   DOUBLE_COLUMN = 3,
+                   CATEGORICAL_COLUMN = 4};
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Enum used to specify the compression format of
+// a compressed file read by this library
+//-------------------------------------------------------------------
+enum blCompressionFormat {AUTO_DETECT_COMPRESSION = 0,
+                          NO_COMPRESSION = 1,
+                          GZIP_COMPRESSION = 2,
+                          ZSTD_COMPRESSION = 3};
+//-------------------------------------------------------------------
+
+
+
 //-------------------------------------------------------------------
 // End of namespace
 }
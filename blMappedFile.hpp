@@ -0,0 +1,651 @@
+#ifndef BL_MAPPEDFILE_HPP
+#define BL_MAPPEDFILE_HPP
+
+
+
+//-------------------------------------------------------------------
+// FILE:            blMappedFile.hpp
+// CLASS:           blMappedFile
+// BASE CLASS:      None
+//
+//
+//
+// PURPOSE:         A small RAII class that maps a file into memory
+//                  (read-only) and exposes it through "const char*"
+//                  begin/end iterators
+//
+//                  -- The iterators can be handed straight to the
+//                     matrix iterators of this library, so that a
+//                     file can be parsed without first copying it
+//                     into a string, for example:
+//
+//                     blMappedFile file("data.csv",SEQUENTIAL_ACCESS);
+//
+//                     blCSVMatrixIterator<const char*,double> iter(file.begin(),
+//                                                                  file.end());
+//
+//                  -- The user can hint the operating system about
+//                     how the data is going to be accessed (normal,
+//                     sequential or random) and can ask for the
+//                     mapping to be backed by huge pages
+//
+//                     -- The hints are only hints, if the operating
+//                        system does not support them they are
+//                        silently ignored
+//
+//                  -- Uses mmap/madvise on POSIX systems and file
+//                     mapping objects on Windows, on any other
+//                     system the file is simply read into memory
+//
+//                  -- The file is unmapped when the object is
+//                     destroyed, so the iterators must not outlive
+//                     the object
+//
+//                  -- This class and its functions are defined within
+//                     the "blAlgorithmsLIB" namespace
+//
+//
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+//
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Includes needed for this file
+//-------------------------------------------------------------------
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <iterator>
+#include <utility>
+
+#if defined(_WIN32)
+#define BL_ALGORITHMSLIB_MAPPEDFILE_USE_WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif defined(__unix__) || defined(__APPLE__)
+#define BL_ALGORITHMSLIB_MAPPEDFILE_USE_POSIX
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#include "blEnumsAndConstants.hpp"
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// NOTE: This class is defined within the blAlgorithmsLIB namespace
+//-------------------------------------------------------------------
+namespace blAlgorithmsLIB
+{
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+class blMappedFile
+{
+public: // Constructors and destructor
+
+
+
+    // Default constructor (no
+    // file mapped)
+
+    blMappedFile();
+
+
+
+    // Constructor that maps
+    // the specified file
+
+    blMappedFile(const std::string& filePath,
+                 const blMemoryAccessHint& accessHint = NORMAL_ACCESS,
+                 const bool& shouldHugePagesBeUsed = false);
+
+
+
+    // A mapping can be moved but
+    // not copied
+
+    blMappedFile(const blMappedFile& mappedFile) = delete;
+
+    blMappedFile(blMappedFile&& mappedFile);
+
+
+
+    // Destructor
+
+    ~blMappedFile();
+
+
+
+public: // Assignment operators
+
+
+
+    blMappedFile&                                                       operator=(const blMappedFile& mappedFile) = delete;
+
+    blMappedFile&                                                       operator=(blMappedFile&& mappedFile);
+
+
+
+public: // Public functions
+
+
+
+    // Functions used to map/unmap a file
+    // The open function returns false if
+    // the file could not be mapped
+
+    bool                                                                open(const std::string& filePath,
+                                                                             const blMemoryAccessHint& accessHint = NORMAL_ACCESS,
+                                                                             const bool& shouldHugePagesBeUsed = false);
+
+    void                                                                close();
+
+
+
+    // Function used to change the access
+    // hint of an already mapped file
+
+    void                                                                setAccessHint(const blMemoryAccessHint& accessHint);
+
+
+
+    // Functions used to get
+    // the mapped data
+
+    bool                                                                isOpen()const;
+
+    const char*                                                         begin()const;
+    const char*                                                         end()const;
+    const char*                                                         data()const;
+
+    const std::size_t&                                                  size()const;
+
+    const std::string&                                                  getFilePath()const;
+    const blMemoryAccessHint&                                           getAccessHint()const;
+
+
+
+protected: // Protected functions
+
+
+
+    // Function used to apply the
+    // hints to the mapped data
+
+    void                                                                adviseOperatingSystem(const bool& shouldHugePagesBeUsed);
+
+
+
+    // Function used to move a mapping
+    // from another object into this one
+
+    void                                                                takeMappingFrom(blMappedFile& mappedFile);
+
+
+
+protected: // Protected variables
+
+
+
+    // The path of the mapped file
+
+    std::string                                                         m_filePath;
+
+
+
+    // The mapped data and its size
+
+    const char*                                                         m_data;
+    std::size_t                                                         m_size;
+
+
+
+    // Flag telling us whether a
+    // file is currently mapped
+    // (an empty file is mapped
+    // but has no data)
+
+    bool                                                                m_isOpen;
+
+
+
+    // The current access hint
+
+    blMemoryAccessHint                                                  m_accessHint;
+
+
+
+    // Operating system handles, or the
+    // buffer holding the file when the
+    // system does not support mapping
+
+#if defined(BL_ALGORITHMSLIB_MAPPEDFILE_USE_WIN32)
+
+    HANDLE                                                              m_fileHandle;
+    HANDLE                                                              m_mappingHandle;
+
+#elif !defined(BL_ALGORITHMSLIB_MAPPEDFILE_USE_POSIX)
+
+    std::vector<char>                                                   m_buffer;
+
+#endif
+};
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Constructors and destructor
+//-------------------------------------------------------------------
+inline blMappedFile::blMappedFile()
+{
+    m_data = nullptr;
+    m_size = 0;
+    m_isOpen = false;
+    m_accessHint = NORMAL_ACCESS;
+
+#if defined(BL_ALGORITHMSLIB_MAPPEDFILE_USE_WIN32)
+
+    m_fileHandle = INVALID_HANDLE_VALUE;
+    m_mappingHandle = NULL;
+
+#endif
+}
+
+
+
+inline blMappedFile::blMappedFile(const std::string& filePath,
+                                  const blMemoryAccessHint& accessHint,
+                                  const bool& shouldHugePagesBeUsed) : blMappedFile()
+{
+    open(filePath,accessHint,shouldHugePagesBeUsed);
+}
+
+
+
+inline blMappedFile::blMappedFile(blMappedFile&& mappedFile) : blMappedFile()
+{
+    takeMappingFrom(mappedFile);
+}
+
+
+
+inline blMappedFile::~blMappedFile()
+{
+    close();
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Move assignment operator
+//-------------------------------------------------------------------
+inline blMappedFile& blMappedFile::operator=(blMappedFile&& mappedFile)
+{
+    if(this != &mappedFile)
+    {
+        close();
+        takeMappingFrom(mappedFile);
+    }
+
+    return (*this);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to move a mapping from another object
+//-------------------------------------------------------------------
+inline void blMappedFile::takeMappingFrom(blMappedFile& mappedFile)
+{
+    m_filePath = std::move(mappedFile.m_filePath);
+    m_data = mappedFile.m_data;
+    m_size = mappedFile.m_size;
+    m_isOpen = mappedFile.m_isOpen;
+    m_accessHint = mappedFile.m_accessHint;
+
+#if defined(BL_ALGORITHMSLIB_MAPPEDFILE_USE_WIN32)
+
+    m_fileHandle = mappedFile.m_fileHandle;
+    m_mappingHandle = mappedFile.m_mappingHandle;
+
+    mappedFile.m_fileHandle = INVALID_HANDLE_VALUE;
+    mappedFile.m_mappingHandle = NULL;
+
+#elif !defined(BL_ALGORITHMSLIB_MAPPEDFILE_USE_POSIX)
+
+    m_buffer = std::move(mappedFile.m_buffer);
+
+#endif
+
+    mappedFile.m_filePath.clear();
+    mappedFile.m_data = nullptr;
+    mappedFile.m_size = 0;
+    mappedFile.m_isOpen = false;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to map a file
+//-------------------------------------------------------------------
+inline bool blMappedFile::open(const std::string& filePath,
+                               const blMemoryAccessHint& accessHint,
+                               const bool& shouldHugePagesBeUsed)
+{
+    close();
+
+    m_accessHint = accessHint;
+
+
+
+#if defined(BL_ALGORITHMSLIB_MAPPEDFILE_USE_POSIX)
+
+    int fileDescriptor = ::open(filePath.c_str(),O_RDONLY);
+
+    if(fileDescriptor < 0)
+        return false;
+
+    struct stat fileStatus;
+
+    if(::fstat(fileDescriptor,&fileStatus) != 0)
+    {
+        ::close(fileDescriptor);
+        return false;
+    }
+
+    m_size = static_cast<std::size_t>(fileStatus.st_size);
+
+
+
+    // An empty file can't be mapped,
+    // but it's still a valid file
+
+    if(m_size > 0)
+    {
+        void* mappedData = ::mmap(nullptr,m_size,PROT_READ,MAP_PRIVATE,fileDescriptor,0);
+
+        if(mappedData == MAP_FAILED)
+        {
+            ::close(fileDescriptor);
+            m_size = 0;
+            return false;
+        }
+
+        m_data = static_cast<const char*>(mappedData);
+    }
+
+
+
+    // The mapping stays valid after
+    // the file descriptor is closed
+
+    ::close(fileDescriptor);
+
+#elif defined(BL_ALGORITHMSLIB_MAPPEDFILE_USE_WIN32)
+
+    DWORD flagsAndAttributes = FILE_ATTRIBUTE_NORMAL;
+
+    if(accessHint == SEQUENTIAL_ACCESS)
+        flagsAndAttributes |= FILE_FLAG_SEQUENTIAL_SCAN;
+    else if(accessHint == RANDOM_ACCESS)
+        flagsAndAttributes |= FILE_FLAG_RANDOM_ACCESS;
+
+    m_fileHandle = ::CreateFileA(filePath.c_str(),
+                                 GENERIC_READ,
+                                 FILE_SHARE_READ,
+                                 NULL,
+                                 OPEN_EXISTING,
+                                 flagsAndAttributes,
+                                 NULL);
+
+    if(m_fileHandle == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER fileSize;
+
+    if(!::GetFileSizeEx(m_fileHandle,&fileSize))
+    {
+        close();
+        return false;
+    }
+
+    m_size = static_cast<std::size_t>(fileSize.QuadPart);
+
+    if(m_size > 0)
+    {
+        m_mappingHandle = ::CreateFileMappingA(m_fileHandle,NULL,PAGE_READONLY,0,0,NULL);
+
+        if(m_mappingHandle == NULL)
+        {
+            close();
+            return false;
+        }
+
+        m_data = static_cast<const char*>(::MapViewOfFile(m_mappingHandle,FILE_MAP_READ,0,0,0));
+
+        if(m_data == nullptr)
+        {
+            close();
+            return false;
+        }
+    }
+
+#else
+
+    std::ifstream fileStream(filePath.c_str(),std::ios::binary);
+
+    if(!fileStream)
+        return false;
+
+    m_buffer.assign(std::istreambuf_iterator<char>(fileStream),
+                    std::istreambuf_iterator<char>());
+
+    m_size = m_buffer.size();
+
+    if(m_size > 0)
+        m_data = &m_buffer[0];
+
+#endif
+
+
+
+    m_filePath = filePath;
+    m_isOpen = true;
+
+    adviseOperatingSystem(shouldHugePagesBeUsed);
+
+    return true;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to unmap the file
+//-------------------------------------------------------------------
+inline void blMappedFile::close()
+{
+#if defined(BL_ALGORITHMSLIB_MAPPEDFILE_USE_POSIX)
+
+    if(m_data != nullptr)
+        ::munmap(const_cast<char*>(m_data),m_size);
+
+#elif defined(BL_ALGORITHMSLIB_MAPPEDFILE_USE_WIN32)
+
+    if(m_data != nullptr)
+        ::UnmapViewOfFile(m_data);
+
+    if(m_mappingHandle != NULL)
+        ::CloseHandle(m_mappingHandle);
+
+    if(m_fileHandle != INVALID_HANDLE_VALUE)
+        ::CloseHandle(m_fileHandle);
+
+    m_mappingHandle = NULL;
+    m_fileHandle = INVALID_HANDLE_VALUE;
+
+#else
+
+    m_buffer.clear();
+
+#endif
+
+    m_data = nullptr;
+    m_size = 0;
+    m_isOpen = false;
+    m_filePath.clear();
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used to hint the operating system about
+// how the mapped data is going to be accessed
+//-------------------------------------------------------------------
+inline void blMappedFile::setAccessHint(const blMemoryAccessHint& accessHint)
+{
+    m_accessHint = accessHint;
+
+    adviseOperatingSystem(false);
+}
+
+
+
+inline void blMappedFile::adviseOperatingSystem(const bool& shouldHugePagesBeUsed)
+{
+    if(m_data == nullptr)
+        return;
+
+#if defined(BL_ALGORITHMSLIB_MAPPEDFILE_USE_POSIX)
+
+    void* mappedData = const_cast<char*>(m_data);
+
+    switch(m_accessHint)
+    {
+    case SEQUENTIAL_ACCESS:
+        ::madvise(mappedData,m_size,MADV_SEQUENTIAL);
+        break;
+
+    case RANDOM_ACCESS:
+        ::madvise(mappedData,m_size,MADV_RANDOM);
+        break;
+
+    default:
+        ::madvise(mappedData,m_size,MADV_NORMAL);
+        break;
+    }
+
+#if defined(MADV_HUGEPAGE)
+
+    // For file backed mappings this only
+    // works if the kernel supports huge
+    // pages for the file's filesystem
+
+    if(shouldHugePagesBeUsed)
+        ::madvise(mappedData,m_size,MADV_HUGEPAGE);
+
+#else
+
+    (void)shouldHugePagesBeUsed;
+
+#endif
+
+#else
+
+    // Windows takes its access hints
+    // when the file is opened and does
+    // not support huge pages for file
+    // mappings
+
+    (void)shouldHugePagesBeUsed;
+
+#endif
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used to get the mapped data
+//-------------------------------------------------------------------
+inline bool blMappedFile::isOpen()const
+{
+    return m_isOpen;
+}
+
+
+
+inline const char* blMappedFile::begin()const
+{
+    return m_data;
+}
+
+
+
+inline const char* blMappedFile::end()const
+{
+    return m_data + m_size;
+}
+
+
+
+inline const char* blMappedFile::data()const
+{
+    return m_data;
+}
+
+
+
+inline const std::size_t& blMappedFile::size()const
+{
+    return m_size;
+}
+
+
+
+inline const std::string& blMappedFile::getFilePath()const
+{
+    return m_filePath;
+}
+
+
+
+inline const blMemoryAccessHint& blMappedFile::getAccessHint()const
+{
+    return m_accessHint;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// End of namespace
+}
+//-------------------------------------------------------------------
+
+
+
+#endif // BL_MAPPEDFILE_HPP
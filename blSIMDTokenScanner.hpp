@@ -0,0 +1,1459 @@
+#ifndef BL_SIMDTOKENSCANNER_HPP
+#define BL_SIMDTOKENSCANNER_HPP
+
+
+
+//-------------------------------------------------------------------
+// FILE:            blSIMDTokenScanner.hpp
+// CLASS:           blSIMDTokenScanner
+//
+//
+//
+// PURPOSE:         A scanner that classifies 64 bytes at a time
+//                  against a small list of tokens and returns a
+//                  64-bit mask with a bit set for every byte that
+//                  matches one of the tokens
+//
+//                  -- Uses AVX2 or SSE2 when the compiler targets
+//                     them, and a lookup table otherwise
+//
+//                  -- The file also defines overloads of the
+//                     "countDataRows" and "findBeginningOfNthDataPoint"
+//                     algorithms for contiguous "char" buffers,
+//                     which find row and column boundaries using
+//                     bit tricks on the token masks instead of
+//                     checking one byte at a time
+//
+//                  -- Quote-aware versions of both algorithms mask
+//                     out tokens inside quoted regions, found with a
+//                     prefix-xor of the quote mask
+//
+//                  -- "scanDataRowsRespectingQuotes" finds the data
+//                     rows and whether the data has any quotes in
+//                     the same pass
+//
+//                  -- Overloads taking already built scanners let
+//                     callers build them once per token list instead
+//                     of on every call, for any other iterator they
+//                     fall back to the token list algorithms
+//
+//                  -- Define BL_ALGORITHMSLIB_DISABLE_SIMD to
+//                     force the lookup table version
+//
+//                  -- All functions/algorithms are defined within
+//                     the "blAlgorithmsLIB" namespace
+//
+//
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+//
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Includes needed for this file
+//-------------------------------------------------------------------
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+
+#if !defined(BL_ALGORITHMSLIB_DISABLE_SIMD) && defined(__AVX2__)
+#define BL_ALGORITHMSLIB_USE_AVX2
+#include <immintrin.h>
+#elif !defined(BL_ALGORITHMSLIB_DISABLE_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define BL_ALGORITHMSLIB_USE_SSE2
+#include <emmintrin.h>
+#endif
+
+#if !defined(BL_ALGORITHMSLIB_DISABLE_SIMD) && defined(__PCLMUL__) && defined(__x86_64__)
+#define BL_ALGORITHMSLIB_USE_PCLMUL
+#include <wmmintrin.h>
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+#include "blCountAndFind.hpp"
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// NOTE: This class is defined within the blAlgorithmsLIB namespace
+//-------------------------------------------------------------------
+namespace blAlgorithmsLIB
+{
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Bit helpers used by the scanner
+//-------------------------------------------------------------------
+inline int countSetBits(std::uint64_t mask)
+{
+#if defined(__GNUC__) || defined(__clang__)
+
+    return __builtin_popcountll(mask);
+
+#else
+
+    int numberOfSetBits = 0;
+
+    while(mask)
+    {
+        mask &= mask - 1;
+        ++numberOfSetBits;
+    }
+
+    return numberOfSetBits;
+
+#endif
+}
+
+
+
+inline int findIndexOfLowestSetBit(const std::uint64_t& mask)
+{
+#if defined(__GNUC__) || defined(__clang__)
+
+    return __builtin_ctzll(mask);
+
+#elif defined(_MSC_VER) && defined(_M_X64)
+
+    unsigned long index = 0;
+    _BitScanForward64(&index,mask);
+    return static_cast<int>(index);
+
+#else
+
+    int index = 0;
+
+    while(((mask >> index) & 1) == 0)
+        ++index;
+
+    return index;
+
+#endif
+}
+
+
+
+inline int findIndexOfHighestSetBit(const std::uint64_t& mask)
+{
+#if defined(__GNUC__) || defined(__clang__)
+
+    return 63 - __builtin_clzll(mask);
+
+#elif defined(_MSC_VER) && defined(_M_X64)
+
+    unsigned long index = 0;
+    _BitScanReverse64(&index,mask);
+    return static_cast<int>(index);
+
+#else
+
+    int index = 63;
+
+    while(((mask >> index) & 1) == 0)
+        --index;
+
+    return index;
+
+#endif
+}
+
+
+
+// Returns a mask where each bit is the
+// xor of all the bits up to and including
+// it, so with a mask of quotes, the bits
+// between an opening and a closing quote
+// end up set
+
+inline std::uint64_t computePrefixXor(std::uint64_t mask)
+{
+#if defined(BL_ALGORITHMSLIB_USE_PCLMUL)
+
+    __m128i carrylessProduct = _mm_clmulepi64_si128(_mm_set_epi64x(0,static_cast<long long>(mask)),
+                                                    _mm_set1_epi8(static_cast<char>(0xFF)),
+                                                    0);
+
+    return static_cast<std::uint64_t>(_mm_cvtsi128_si64(carrylessProduct));
+
+#else
+
+    mask ^= mask << 1;
+    mask ^= mask << 2;
+    mask ^= mask << 4;
+    mask ^= mask << 8;
+    mask ^= mask << 16;
+    mask ^= mask << 32;
+
+    return mask;
+
+#endif
+}
+
+
+
+// Returns the index of the
+// nth (zero based) set bit
+
+inline int findIndexOfNthSetBit(std::uint64_t mask,int n)
+{
+    while(n > 0)
+    {
+        mask &= mask - 1;
+        --n;
+    }
+
+    return findIndexOfLowestSetBit(mask);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+class blSIMDTokenScanner
+{
+public: // Constructors and destructor
+
+
+
+    // Default constructor (a
+    // scanner of no tokens)
+
+    blSIMDTokenScanner()
+    {
+        std::fill(m_isToken,m_isToken + 256,false);
+
+        m_numberOfTokens = 0;
+        m_shouldVectorPathBeUsed = true;
+    }
+
+
+
+    // Constructors from a
+    // list of tokens
+
+    template<typename blTokenIteratorType>
+
+    blSIMDTokenScanner(const blTokenIteratorType& tokensBeginIter,
+                       const blTokenIteratorType& tokensEndIter);
+
+    blSIMDTokenScanner(const std::string& tokens)
+        : blSIMDTokenScanner(tokens.begin(),tokens.end())
+    {
+    }
+
+
+
+    // Destructor
+
+    ~blSIMDTokenScanner()
+    {
+    }
+
+
+
+public: // Public functions
+
+
+
+    // Function used to get the token
+    // mask of a full block of 64 bytes
+
+    std::uint64_t                                                       getTokenMask(const char* blockBeginIter)const;
+
+
+
+    // Function used to get the
+    // token mask of the last (and
+    // possibly partial) block
+    // The bits past the length
+    // are always zero
+
+    std::uint64_t                                                       getTokenMask(const char* blockBeginIter,
+                                                                                     const std::ptrdiff_t& blockLength)const;
+
+
+
+    // Function used to check
+    // whether a byte is a token
+
+    bool                                                                isToken(const char& character)const;
+
+
+
+    // Function used to get the
+    // distinct tokens scanned for
+
+    const std::string&                                                  getTokens()const;
+
+
+
+protected: // Protected variables
+
+
+
+    // The distinct tokens, the
+    // vector path is only used
+    // when there are few of them
+
+    static const int                                                    s_maxNumberOfVectorTokens = 8;
+
+    char                                                                m_tokens[s_maxNumberOfVectorTokens];
+    int                                                                 m_numberOfTokens;
+
+    bool                                                                m_shouldVectorPathBeUsed;
+
+
+
+    // Lookup table used by the
+    // scalar path and the tails
+
+    bool                                                                m_isToken[256];
+
+
+
+    // All the distinct tokens, used
+    // when falling back to the token
+    // list algorithms
+
+    std::string                                                         m_distinctTokens;
+};
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+template<typename blTokenIteratorType>
+
+inline blSIMDTokenScanner::blSIMDTokenScanner(const blTokenIteratorType& tokensBeginIter,
+                                              const blTokenIteratorType& tokensEndIter)
+{
+    std::fill(m_isToken,m_isToken + 256,false);
+
+    m_numberOfTokens = 0;
+    m_shouldVectorPathBeUsed = true;
+
+    for(auto tokenIter = tokensBeginIter; tokenIter != tokensEndIter; ++tokenIter)
+    {
+        unsigned char token = static_cast<unsigned char>(*tokenIter);
+
+        if(m_isToken[token])
+            continue;
+
+        m_isToken[token] = true;
+        m_distinctTokens.push_back(static_cast<char>(token));
+
+        if(m_numberOfTokens < s_maxNumberOfVectorTokens)
+        {
+            m_tokens[m_numberOfTokens] = static_cast<char>(token);
+            ++m_numberOfTokens;
+        }
+        else
+            m_shouldVectorPathBeUsed = false;
+    }
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+inline bool blSIMDTokenScanner::isToken(const char& character)const
+{
+    return m_isToken[static_cast<unsigned char>(character)];
+}
+
+
+
+inline const std::string& blSIMDTokenScanner::getTokens()const
+{
+    return m_distinctTokens;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+inline std::uint64_t blSIMDTokenScanner::getTokenMask(const char* blockBeginIter)const
+{
+#if defined(BL_ALGORITHMSLIB_USE_AVX2)
+
+    if(m_shouldVectorPathBeUsed)
+    {
+        __m256i lowHalf = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(blockBeginIter));
+        __m256i highHalf = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(blockBeginIter + 32));
+
+        __m256i lowMatches = _mm256_setzero_si256();
+        __m256i highMatches = _mm256_setzero_si256();
+
+        for(int i = 0; i < m_numberOfTokens; ++i)
+        {
+            __m256i token = _mm256_set1_epi8(m_tokens[i]);
+
+            lowMatches = _mm256_or_si256(lowMatches,_mm256_cmpeq_epi8(lowHalf,token));
+            highMatches = _mm256_or_si256(highMatches,_mm256_cmpeq_epi8(highHalf,token));
+        }
+
+        return static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm256_movemask_epi8(lowMatches))) |
+               (static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm256_movemask_epi8(highMatches))) << 32);
+    }
+
+#elif defined(BL_ALGORITHMSLIB_USE_SSE2)
+
+    if(m_shouldVectorPathBeUsed)
+    {
+        __m128i quarters[4];
+        __m128i matches[4];
+
+        for(int j = 0; j < 4; ++j)
+        {
+            quarters[j] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(blockBeginIter + 16 * j));
+            matches[j] = _mm_setzero_si128();
+        }
+
+        for(int i = 0; i < m_numberOfTokens; ++i)
+        {
+            __m128i token = _mm_set1_epi8(m_tokens[i]);
+
+            for(int j = 0; j < 4; ++j)
+                matches[j] = _mm_or_si128(matches[j],_mm_cmpeq_epi8(quarters[j],token));
+        }
+
+        std::uint64_t mask = 0;
+
+        for(int j = 0; j < 4; ++j)
+            mask |= static_cast<std::uint64_t>(static_cast<std::uint16_t>(_mm_movemask_epi8(matches[j]))) << (16 * j);
+
+        return mask;
+    }
+
+#endif
+
+    return getTokenMask(blockBeginIter,64);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+inline std::uint64_t blSIMDTokenScanner::getTokenMask(const char* blockBeginIter,
+                                                      const std::ptrdiff_t& blockLength)const
+{
+    std::uint64_t mask = 0;
+
+    for(std::ptrdiff_t i = 0; i < blockLength; ++i)
+    {
+        if(m_isToken[static_cast<unsigned char>(blockBeginIter[i])])
+            mask |= std::uint64_t(1) << i;
+    }
+
+    return mask;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to walk a contiguous buffer one 64 byte
+// block at a time, calling the functor with the offset of
+// each block and the mask of the bytes that begin a data
+// point (or a data row)
+//
+// A data point begins at the first byte and right after
+// every token, and when zero length data points are not
+// counted, only if the byte itself is not a token
+//
+// If a quote scanner is passed, tokens between a pair of
+// quotes are masked out, the quoted regions are found with
+// a prefix-xor of the quote mask, so an escaped quote ("")
+// simply toggles the state twice
+// Without a quote scanner the walk does no quote work at all
+//
+// The functor returns false to stop the walk
+//-------------------------------------------------------------------
+template<typename blFunctorType>
+
+inline void forEachBlockOfDataPointBeginnings(const char* beginIter,
+                                              const char* endIter,
+                                              const blSIMDTokenScanner& tokenScanner,
+                                              const blSIMDTokenScanner* quoteScanner,
+                                              const bool& shouldZeroLengthDataPointsBeCounted,
+                                              blFunctorType& functor)
+{
+    std::ptrdiff_t bufferLength = endIter - beginIter;
+
+
+
+    // The carry tells us whether the
+    // byte right before the current
+    // block was a token, and we treat
+    // the beginning of the buffer as
+    // if it followed a token
+
+    std::uint64_t carry = 1;
+
+
+
+    // All ones if the previous block
+    // ended inside a quoted region
+
+    std::uint64_t insideQuotesCarry = 0;
+
+
+
+    for(std::ptrdiff_t blockOffset = 0; blockOffset < bufferLength; blockOffset += 64)
+    {
+        std::ptrdiff_t blockLength = std::min(bufferLength - blockOffset,std::ptrdiff_t(64));
+
+        std::uint64_t tokenMask;
+        std::uint64_t validMask;
+
+        if(blockLength == 64)
+        {
+            tokenMask = tokenScanner.getTokenMask(beginIter + blockOffset);
+            validMask = ~std::uint64_t(0);
+        }
+        else
+        {
+            tokenMask = tokenScanner.getTokenMask(beginIter + blockOffset,blockLength);
+            validMask = (std::uint64_t(1) << blockLength) - 1;
+        }
+
+        if(quoteScanner)
+        {
+            std::uint64_t quoteMask = (blockLength == 64) ? quoteScanner->getTokenMask(beginIter + blockOffset) :
+                                                            quoteScanner->getTokenMask(beginIter + blockOffset,blockLength);
+
+            std::uint64_t insideQuotesMask = computePrefixXor(quoteMask) ^ insideQuotesCarry;
+
+            tokenMask &= ~insideQuotesMask;
+
+            insideQuotesCarry = std::uint64_t(0) - (insideQuotesMask >> 63);
+        }
+
+        std::uint64_t followsTokenMask = (tokenMask << 1) | carry;
+
+        std::uint64_t beginningsMask = followsTokenMask & validMask;
+
+        if(!shouldZeroLengthDataPointsBeCounted)
+            beginningsMask &= ~tokenMask;
+
+        carry = tokenMask >> 63;
+
+        if(!functor(blockOffset,beginningsMask))
+            break;
+    }
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to count the data points (or data rows)
+// in a contiguous buffer
+//-------------------------------------------------------------------
+inline std::size_t countDataPointsInCharBuffer(const char* beginIter,
+                                               const char* endIter,
+                                               const blSIMDTokenScanner& tokenScanner,
+                                               const blSIMDTokenScanner* quoteScanner,
+                                               const bool& shouldZeroLengthDataPointsBeCounted)
+{
+    std::size_t totalNumberOfDataPoints = 0;
+
+    auto countDataPoints = [&totalNumberOfDataPoints](const std::ptrdiff_t&,const std::uint64_t& beginningsMask)
+    {
+        totalNumberOfDataPoints += static_cast<std::size_t>(countSetBits(beginningsMask));
+        return true;
+    };
+
+    forEachBlockOfDataPointBeginnings(beginIter,
+                                      endIter,
+                                      tokenScanner,
+                                      quoteScanner,
+                                      shouldZeroLengthDataPointsBeCounted,
+                                      countDataPoints);
+
+    return totalNumberOfDataPoints;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to find the beginning of the nth data
+// point in a contiguous buffer, it returns the "actual"
+// data point index found in case there are less than
+// "n" data points (-1 if there are none)
+//-------------------------------------------------------------------
+inline std::ptrdiff_t findBeginningOfNthDataPointInCharBuffer(const char* beginIter,
+                                                              const char* endIter,
+                                                              const blSIMDTokenScanner& tokenScanner,
+                                                              const blSIMDTokenScanner* quoteScanner,
+                                                              const bool& shouldZeroLengthDataPointsBeCounted,
+                                                              const std::ptrdiff_t& whichDataPointToFind,
+                                                              const char*& nthDataPointBeginIter)
+{
+    nthDataPointBeginIter = beginIter;
+
+    std::ptrdiff_t currentDataPoint = -1;
+
+    if(beginIter == endIter || whichDataPointToFind < 0)
+        return currentDataPoint;
+
+
+
+    // We skip whole blocks by counting
+    // their data point beginnings, and
+    // only look for the exact bit in
+    // the block holding the nth one
+
+    auto findNthDataPoint = [&](const std::ptrdiff_t& blockOffset,const std::uint64_t& beginningsMask)
+    {
+        if(beginningsMask == 0)
+            return true;
+
+        std::ptrdiff_t numberOfDataPointsInBlock = countSetBits(beginningsMask);
+
+        if(currentDataPoint + numberOfDataPointsInBlock >= whichDataPointToFind)
+        {
+            int whichBit = static_cast<int>(whichDataPointToFind - currentDataPoint - 1);
+
+            nthDataPointBeginIter = beginIter + blockOffset + findIndexOfNthSetBit(beginningsMask,whichBit);
+            currentDataPoint = whichDataPointToFind;
+
+            return false;
+        }
+
+        currentDataPoint += numberOfDataPointsInBlock;
+        nthDataPointBeginIter = beginIter + blockOffset + findIndexOfHighestSetBit(beginningsMask);
+
+        return true;
+    };
+
+    forEachBlockOfDataPointBeginnings(beginIter,
+                                      endIter,
+                                      tokenScanner,
+                                      quoteScanner,
+                                      shouldZeroLengthDataPointsBeCounted,
+                                      findNthDataPoint);
+
+    return currentDataPoint;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to find the data rows of a buffer in a
+// single quote-aware pass, it returns the number of rows,
+// records the offset of each row (counted from the offset
+// of the beginning of the buffer) and the number of fields
+// of each row when asked to, and tells whether the buffer
+// has any quotes, so that callers don't need a separate
+// pass over the data to find out
+//
+// Zero length rows and fields are not counted, the fields
+// of a row are separated by column (or row) tokens, and
+// without any quotes the rows found are the ones of
+// "countDataRows"
+//-------------------------------------------------------------------
+template<typename blDataIteratorType>
+
+inline std::size_t scanDataRowsRespectingQuotes(const blDataIteratorType& beginIter,
+                                                const blDataIteratorType& endIter,
+                                                const blSIMDTokenScanner& rowTokenScanner,
+                                                const blSIMDTokenScanner& colTokenScanner,
+                                                const blSIMDTokenScanner& quoteTokenScanner,
+                                                const std::ptrdiff_t& beginOffset,
+                                                std::vector<std::ptrdiff_t>* rowOffsets,
+                                                std::vector<std::ptrdiff_t>* rowFieldCounts,
+                                                bool& hasQuoteBeenFound)
+{
+    std::size_t totalNumberOfRows = 0;
+
+    std::ptrdiff_t currentOffset = beginOffset;
+    std::ptrdiff_t numberOfFieldsInRow = 0;
+
+    bool isInsideQuotes = false;
+    bool doesByteFollowRowToken = true;
+    bool doesByteFollowToken = true;
+
+    hasQuoteBeenFound = false;
+
+
+
+    for(auto currentIter = beginIter; currentIter != endIter; ++currentIter,++currentOffset)
+    {
+        bool isRowToken = false;
+        bool isColToken = false;
+
+        if(quoteTokenScanner.isToken(*currentIter))
+        {
+            isInsideQuotes = !isInsideQuotes;
+            hasQuoteBeenFound = true;
+        }
+        else if(!isInsideQuotes)
+        {
+            isRowToken = rowTokenScanner.isToken(*currentIter);
+            isColToken = (rowFieldCounts && !isRowToken && colTokenScanner.isToken(*currentIter));
+        }
+
+        if(!isRowToken && doesByteFollowRowToken)
+        {
+            if(rowFieldCounts && totalNumberOfRows > 0)
+                rowFieldCounts->push_back(numberOfFieldsInRow);
+
+            ++totalNumberOfRows;
+            numberOfFieldsInRow = 0;
+
+            if(rowOffsets)
+                rowOffsets->push_back(currentOffset);
+        }
+
+        if(!isRowToken && !isColToken && doesByteFollowToken)
+            ++numberOfFieldsInRow;
+
+        doesByteFollowRowToken = isRowToken;
+        doesByteFollowToken = (isRowToken || isColToken);
+    }
+
+    if(rowFieldCounts && totalNumberOfRows > 0)
+        rowFieldCounts->push_back(numberOfFieldsInRow);
+
+
+
+    return totalNumberOfRows;
+}
+
+
+
+inline std::size_t scanDataRowsRespectingQuotes(const char* const& beginIter,
+                                                const char* const& endIter,
+                                                const blSIMDTokenScanner& rowTokenScanner,
+                                                const blSIMDTokenScanner& colTokenScanner,
+                                                const blSIMDTokenScanner& quoteTokenScanner,
+                                                const std::ptrdiff_t& beginOffset,
+                                                std::vector<std::ptrdiff_t>* rowOffsets,
+                                                std::vector<std::ptrdiff_t>* rowFieldCounts,
+                                                bool& hasQuoteBeenFound)
+{
+    std::size_t totalNumberOfRows = 0;
+
+    std::ptrdiff_t bufferLength = endIter - beginIter;
+    std::ptrdiff_t numberOfFieldsInRow = 0;
+
+    hasQuoteBeenFound = false;
+
+
+
+    // The carries tell us whether the
+    // byte before the current block was
+    // a row token (or any token) with
+    // the beginning of the buffer treated
+    // as if it followed one, and whether
+    // the block begins inside a quoted
+    // region
+
+    std::uint64_t carry = 1;
+    std::uint64_t anyTokenCarry = 1;
+    std::uint64_t insideQuotesCarry = 0;
+
+
+
+    for(std::ptrdiff_t blockOffset = 0; blockOffset < bufferLength; blockOffset += 64)
+    {
+        std::ptrdiff_t blockLength = std::min(bufferLength - blockOffset,std::ptrdiff_t(64));
+
+        std::uint64_t tokenMask;
+        std::uint64_t colTokenMask = 0;
+        std::uint64_t quoteMask;
+        std::uint64_t validMask;
+
+        if(blockLength == 64)
+        {
+            tokenMask = rowTokenScanner.getTokenMask(beginIter + blockOffset);
+            quoteMask = quoteTokenScanner.getTokenMask(beginIter + blockOffset);
+            validMask = ~std::uint64_t(0);
+
+            if(rowFieldCounts)
+                colTokenMask = colTokenScanner.getTokenMask(beginIter + blockOffset);
+        }
+        else
+        {
+            tokenMask = rowTokenScanner.getTokenMask(beginIter + blockOffset,blockLength);
+            quoteMask = quoteTokenScanner.getTokenMask(beginIter + blockOffset,blockLength);
+            validMask = (std::uint64_t(1) << blockLength) - 1;
+
+            if(rowFieldCounts)
+                colTokenMask = colTokenScanner.getTokenMask(beginIter + blockOffset,blockLength);
+        }
+
+
+
+        // The quote mask is already there,
+        // so finding out whether the data
+        // has quotes costs nothing, and the
+        // quoted regions are only computed
+        // when there are any
+
+        if(quoteMask != 0 || insideQuotesCarry != 0)
+        {
+            if(quoteMask != 0)
+                hasQuoteBeenFound = true;
+
+            std::uint64_t insideQuotesMask = computePrefixXor(quoteMask) ^ insideQuotesCarry;
+
+            tokenMask &= ~insideQuotesMask;
+            colTokenMask &= ~insideQuotesMask;
+
+            insideQuotesCarry = std::uint64_t(0) - (insideQuotesMask >> 63);
+        }
+
+
+
+        std::uint64_t beginningsMask = ((tokenMask << 1) | carry) & validMask & ~tokenMask;
+
+        carry = tokenMask >> 63;
+
+        if(rowFieldCounts)
+        {
+            // We walk the beginnings of the
+            // rows and of the fields in order,
+            // a row's count is complete when
+            // the next row begins
+
+            std::uint64_t anyTokenMask = tokenMask | colTokenMask;
+
+            std::uint64_t fieldBeginningsMask = ((anyTokenMask << 1) | anyTokenCarry) & validMask & ~anyTokenMask;
+
+            anyTokenCarry = anyTokenMask >> 63;
+
+            std::uint64_t eventsMask = beginningsMask | fieldBeginningsMask;
+
+            while(eventsMask)
+            {
+                int whichBit = findIndexOfLowestSetBit(eventsMask);
+
+                if((beginningsMask >> whichBit) & 1)
+                {
+                    if(totalNumberOfRows > 0)
+                        rowFieldCounts->push_back(numberOfFieldsInRow);
+
+                    ++totalNumberOfRows;
+                    numberOfFieldsInRow = 0;
+
+                    if(rowOffsets)
+                        rowOffsets->push_back(beginOffset + blockOffset + whichBit);
+                }
+
+                if((fieldBeginningsMask >> whichBit) & 1)
+                    ++numberOfFieldsInRow;
+
+                eventsMask &= eventsMask - 1;
+            }
+        }
+        else
+        {
+            totalNumberOfRows += static_cast<std::size_t>(countSetBits(beginningsMask));
+
+            if(rowOffsets)
+            {
+                while(beginningsMask)
+                {
+                    rowOffsets->push_back(beginOffset + blockOffset + findIndexOfLowestSetBit(beginningsMask));
+                    beginningsMask &= beginningsMask - 1;
+                }
+            }
+        }
+    }
+
+    if(rowFieldCounts && totalNumberOfRows > 0)
+        rowFieldCounts->push_back(numberOfFieldsInRow);
+
+
+
+    return totalNumberOfRows;
+}
+
+
+
+inline std::size_t scanDataRowsRespectingQuotes(char* const& beginIter,
+                                                char* const& endIter,
+                                                const blSIMDTokenScanner& rowTokenScanner,
+                                                const blSIMDTokenScanner& colTokenScanner,
+                                                const blSIMDTokenScanner& quoteTokenScanner,
+                                                const std::ptrdiff_t& beginOffset,
+                                                std::vector<std::ptrdiff_t>* rowOffsets,
+                                                std::vector<std::ptrdiff_t>* rowFieldCounts,
+                                                bool& hasQuoteBeenFound)
+{
+    const char* constBeginIter = beginIter;
+    const char* constEndIter = endIter;
+
+    return scanDataRowsRespectingQuotes(constBeginIter,
+                                        constEndIter,
+                                        rowTokenScanner,
+                                        colTokenScanner,
+                                        quoteTokenScanner,
+                                        beginOffset,
+                                        rowOffsets,
+                                        rowFieldCounts,
+                                        hasQuoteBeenFound);
+}
+
+
+
+// The characters of a string are
+// contiguous, so its iterators can
+// use the char buffer version too
+
+inline std::size_t scanDataRowsRespectingQuotes(const std::string::const_iterator& beginIter,
+                                                const std::string::const_iterator& endIter,
+                                                const blSIMDTokenScanner& rowTokenScanner,
+                                                const blSIMDTokenScanner& colTokenScanner,
+                                                const blSIMDTokenScanner& quoteTokenScanner,
+                                                const std::ptrdiff_t& beginOffset,
+                                                std::vector<std::ptrdiff_t>* rowOffsets,
+                                                std::vector<std::ptrdiff_t>* rowFieldCounts,
+                                                bool& hasQuoteBeenFound)
+{
+    if(beginIter == endIter)
+    {
+        hasQuoteBeenFound = false;
+        return 0;
+    }
+
+    const char* constBeginIter = &(*beginIter);
+    const char* constEndIter = constBeginIter + (endIter - beginIter);
+
+    return scanDataRowsRespectingQuotes(constBeginIter,
+                                        constEndIter,
+                                        rowTokenScanner,
+                                        colTokenScanner,
+                                        quoteTokenScanner,
+                                        beginOffset,
+                                        rowOffsets,
+                                        rowFieldCounts,
+                                        hasQuoteBeenFound);
+}
+
+
+
+inline std::size_t scanDataRowsRespectingQuotes(const std::string::iterator& beginIter,
+                                                const std::string::iterator& endIter,
+                                                const blSIMDTokenScanner& rowTokenScanner,
+                                                const blSIMDTokenScanner& colTokenScanner,
+                                                const blSIMDTokenScanner& quoteTokenScanner,
+                                                const std::ptrdiff_t& beginOffset,
+                                                std::vector<std::ptrdiff_t>* rowOffsets,
+                                                std::vector<std::ptrdiff_t>* rowFieldCounts,
+                                                bool& hasQuoteBeenFound)
+{
+    return scanDataRowsRespectingQuotes(std::string::const_iterator(beginIter),
+                                        std::string::const_iterator(endIter),
+                                        rowTokenScanner,
+                                        colTokenScanner,
+                                        quoteTokenScanner,
+                                        beginOffset,
+                                        rowOffsets,
+                                        rowFieldCounts,
+                                        hasQuoteBeenFound);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Overloads of the "countDataRows" and
+// "countDataRowsRespectingQuotes" algorithms
+// for contiguous char buffers
+//-------------------------------------------------------------------
+template<typename blTokenIteratorType>
+
+inline std::size_t countDataRows(const char* const& beginIter,
+                                 const char* const& endIter,
+                                 const blTokenIteratorType& rowTokensBeginIter,
+                                 const blTokenIteratorType& rowTokensEndIter,
+                                 const bool& shouldZeroLengthRowsBeCounted)
+{
+    blSIMDTokenScanner tokenScanner(rowTokensBeginIter,rowTokensEndIter);
+
+    return countDataPointsInCharBuffer(beginIter,
+                                       endIter,
+                                       tokenScanner,
+                                       nullptr,
+                                       shouldZeroLengthRowsBeCounted);
+}
+
+
+
+template<typename blTokenIteratorType>
+
+inline std::size_t countDataRows(char* const& beginIter,
+                                 char* const& endIter,
+                                 const blTokenIteratorType& rowTokensBeginIter,
+                                 const blTokenIteratorType& rowTokensEndIter,
+                                 const bool& shouldZeroLengthRowsBeCounted)
+{
+    blSIMDTokenScanner tokenScanner(rowTokensBeginIter,rowTokensEndIter);
+
+    return countDataPointsInCharBuffer(beginIter,
+                                       endIter,
+                                       tokenScanner,
+                                       nullptr,
+                                       shouldZeroLengthRowsBeCounted);
+}
+
+
+
+template<typename blTokenIteratorType,
+         typename blQuoteTokenType>
+
+inline std::size_t countDataRowsRespectingQuotes(const char* const& beginIter,
+                                                 const char* const& endIter,
+                                                 const blTokenIteratorType& rowTokensBeginIter,
+                                                 const blTokenIteratorType& rowTokensEndIter,
+                                                 const bool& shouldZeroLengthRowsBeCounted,
+                                                 const blQuoteTokenType& quoteToken)
+{
+    const char quoteTokenAsChar = static_cast<char>(quoteToken);
+
+    blSIMDTokenScanner tokenScanner(rowTokensBeginIter,rowTokensEndIter);
+    blSIMDTokenScanner quoteScanner(&quoteTokenAsChar,&quoteTokenAsChar + 1);
+
+    return countDataPointsInCharBuffer(beginIter,
+                                       endIter,
+                                       tokenScanner,
+                                       &quoteScanner,
+                                       shouldZeroLengthRowsBeCounted);
+}
+
+
+
+template<typename blTokenIteratorType,
+         typename blQuoteTokenType>
+
+inline std::size_t countDataRowsRespectingQuotes(char* const& beginIter,
+                                                 char* const& endIter,
+                                                 const blTokenIteratorType& rowTokensBeginIter,
+                                                 const blTokenIteratorType& rowTokensEndIter,
+                                                 const bool& shouldZeroLengthRowsBeCounted,
+                                                 const blQuoteTokenType& quoteToken)
+{
+    const char* constBeginIter = beginIter;
+    const char* constEndIter = endIter;
+
+    return countDataRowsRespectingQuotes(constBeginIter,
+                                         constEndIter,
+                                         rowTokensBeginIter,
+                                         rowTokensEndIter,
+                                         shouldZeroLengthRowsBeCounted,
+                                         quoteToken);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Overloads of the "findBeginningOfNthDataPoint" and
+// "findBeginningOfNthDataPointRespectingQuotes"
+// algorithms for contiguous char buffers
+//-------------------------------------------------------------------
+template<typename blTokenIteratorType,
+         typename blIntegerType>
+
+inline blIntegerType findBeginningOfNthDataPoint(const char* const& dataBeginIter,
+                                                 const char* const& dataEndIter,
+                                                 const blTokenIteratorType& tokenListBeginIter,
+                                                 const blTokenIteratorType& tokenListEndIter,
+                                                 const bool& shouldZeroLengthRowsBeCounted,
+                                                 const blIntegerType& whichDataPointToFind,
+                                                 const char*& nthDataPointBeginIter)
+{
+    blSIMDTokenScanner tokenScanner(tokenListBeginIter,tokenListEndIter);
+
+    return static_cast<blIntegerType>(findBeginningOfNthDataPointInCharBuffer(dataBeginIter,
+                                                                              dataEndIter,
+                                                                              tokenScanner,
+                                                                              nullptr,
+                                                                              shouldZeroLengthRowsBeCounted,
+                                                                              static_cast<std::ptrdiff_t>(whichDataPointToFind),
+                                                                              nthDataPointBeginIter));
+}
+
+
+
+template<typename blTokenIteratorType,
+         typename blIntegerType>
+
+inline blIntegerType findBeginningOfNthDataPoint(char* const& dataBeginIter,
+                                                 char* const& dataEndIter,
+                                                 const blTokenIteratorType& tokenListBeginIter,
+                                                 const blTokenIteratorType& tokenListEndIter,
+                                                 const bool& shouldZeroLengthRowsBeCounted,
+                                                 const blIntegerType& whichDataPointToFind,
+                                                 char*& nthDataPointBeginIter)
+{
+    // We copy the inputs since the
+    // output iterator could be one
+    // of them
+
+    char* beginIter = dataBeginIter;
+
+    const char* constNthDataPointBeginIter = beginIter;
+
+    blSIMDTokenScanner tokenScanner(tokenListBeginIter,tokenListEndIter);
+
+    std::ptrdiff_t dataPointFound = findBeginningOfNthDataPointInCharBuffer(beginIter,
+                                                                            dataEndIter,
+                                                                            tokenScanner,
+                                                                            nullptr,
+                                                                            shouldZeroLengthRowsBeCounted,
+                                                                            static_cast<std::ptrdiff_t>(whichDataPointToFind),
+                                                                            constNthDataPointBeginIter);
+
+    nthDataPointBeginIter = beginIter + (constNthDataPointBeginIter - beginIter);
+
+    return static_cast<blIntegerType>(dataPointFound);
+}
+
+
+
+template<typename blTokenIteratorType,
+         typename blQuoteTokenType,
+         typename blIntegerType>
+
+inline blIntegerType findBeginningOfNthDataPointRespectingQuotes(const char* const& dataBeginIter,
+                                                                 const char* const& dataEndIter,
+                                                                 const blTokenIteratorType& tokenListBeginIter,
+                                                                 const blTokenIteratorType& tokenListEndIter,
+                                                                 const bool& shouldZeroLengthRowsBeCounted,
+                                                                 const blQuoteTokenType& quoteToken,
+                                                                 const blIntegerType& whichDataPointToFind,
+                                                                 const char*& nthDataPointBeginIter)
+{
+    const char quoteTokenAsChar = static_cast<char>(quoteToken);
+
+    blSIMDTokenScanner tokenScanner(tokenListBeginIter,tokenListEndIter);
+    blSIMDTokenScanner quoteScanner(&quoteTokenAsChar,&quoteTokenAsChar + 1);
+
+    return static_cast<blIntegerType>(findBeginningOfNthDataPointInCharBuffer(dataBeginIter,
+                                                                              dataEndIter,
+                                                                              tokenScanner,
+                                                                              &quoteScanner,
+                                                                              shouldZeroLengthRowsBeCounted,
+                                                                              static_cast<std::ptrdiff_t>(whichDataPointToFind),
+                                                                              nthDataPointBeginIter));
+}
+
+
+
+template<typename blTokenIteratorType,
+         typename blQuoteTokenType,
+         typename blIntegerType>
+
+inline blIntegerType findBeginningOfNthDataPointRespectingQuotes(char* const& dataBeginIter,
+                                                                 char* const& dataEndIter,
+                                                                 const blTokenIteratorType& tokenListBeginIter,
+                                                                 const blTokenIteratorType& tokenListEndIter,
+                                                                 const bool& shouldZeroLengthRowsBeCounted,
+                                                                 const blQuoteTokenType& quoteToken,
+                                                                 const blIntegerType& whichDataPointToFind,
+                                                                 char*& nthDataPointBeginIter)
+{
+    char* beginIter = dataBeginIter;
+
+    const char* constDataBeginIter = beginIter;
+    const char* constDataEndIter = dataEndIter;
+    const char* constNthDataPointBeginIter = beginIter;
+
+    blIntegerType dataPointFound = findBeginningOfNthDataPointRespectingQuotes(constDataBeginIter,
+                                                                               constDataEndIter,
+                                                                               tokenListBeginIter,
+                                                                               tokenListEndIter,
+                                                                               shouldZeroLengthRowsBeCounted,
+                                                                               quoteToken,
+                                                                               whichDataPointToFind,
+                                                                               constNthDataPointBeginIter);
+
+    nthDataPointBeginIter = beginIter + (constNthDataPointBeginIter - constDataBeginIter);
+
+    return dataPointFound;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Overloads of the "countDataRows" and
+// "countDataRowsRespectingQuotes" algorithms taking
+// already built scanners, the quote scanner is a scanner
+// of the quote token
+//-------------------------------------------------------------------
+template<typename blDataIteratorType>
+
+inline std::size_t countDataRows(const blDataIteratorType& beginIter,
+                                 const blDataIteratorType& endIter,
+                                 const blSIMDTokenScanner& rowTokenScanner,
+                                 const bool& shouldZeroLengthRowsBeCounted)
+{
+    return countDataRows(beginIter,
+                         endIter,
+                         rowTokenScanner.getTokens().begin(),
+                         rowTokenScanner.getTokens().end(),
+                         shouldZeroLengthRowsBeCounted);
+}
+
+
+
+inline std::size_t countDataRows(const char* const& beginIter,
+                                 const char* const& endIter,
+                                 const blSIMDTokenScanner& rowTokenScanner,
+                                 const bool& shouldZeroLengthRowsBeCounted)
+{
+    return countDataPointsInCharBuffer(beginIter,
+                                       endIter,
+                                       rowTokenScanner,
+                                       nullptr,
+                                       shouldZeroLengthRowsBeCounted);
+}
+
+
+
+inline std::size_t countDataRows(char* const& beginIter,
+                                 char* const& endIter,
+                                 const blSIMDTokenScanner& rowTokenScanner,
+                                 const bool& shouldZeroLengthRowsBeCounted)
+{
+    return countDataPointsInCharBuffer(beginIter,
+                                       endIter,
+                                       rowTokenScanner,
+                                       nullptr,
+                                       shouldZeroLengthRowsBeCounted);
+}
+
+
+
+template<typename blDataIteratorType>
+
+inline std::size_t countDataRowsRespectingQuotes(const blDataIteratorType& beginIter,
+                                                 const blDataIteratorType& endIter,
+                                                 const blSIMDTokenScanner& rowTokenScanner,
+                                                 const bool& shouldZeroLengthRowsBeCounted,
+                                                 const blSIMDTokenScanner& quoteTokenScanner)
+{
+    return countDataRowsRespectingQuotes(beginIter,
+                                         endIter,
+                                         rowTokenScanner.getTokens().begin(),
+                                         rowTokenScanner.getTokens().end(),
+                                         shouldZeroLengthRowsBeCounted,
+                                         quoteTokenScanner.getTokens()[0]);
+}
+
+
+
+inline std::size_t countDataRowsRespectingQuotes(const char* const& beginIter,
+                                                 const char* const& endIter,
+                                                 const blSIMDTokenScanner& rowTokenScanner,
+                                                 const bool& shouldZeroLengthRowsBeCounted,
+                                                 const blSIMDTokenScanner& quoteTokenScanner)
+{
+    return countDataPointsInCharBuffer(beginIter,
+                                       endIter,
+                                       rowTokenScanner,
+                                       &quoteTokenScanner,
+                                       shouldZeroLengthRowsBeCounted);
+}
+
+
+
+inline std::size_t countDataRowsRespectingQuotes(char* const& beginIter,
+                                                 char* const& endIter,
+                                                 const blSIMDTokenScanner& rowTokenScanner,
+                                                 const bool& shouldZeroLengthRowsBeCounted,
+                                                 const blSIMDTokenScanner& quoteTokenScanner)
+{
+    return countDataPointsInCharBuffer(beginIter,
+                                       endIter,
+                                       rowTokenScanner,
+                                       &quoteTokenScanner,
+                                       shouldZeroLengthRowsBeCounted);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Overloads of the "findBeginningOfNthDataPoint" and
+// "findBeginningOfNthDataPointRespectingQuotes"
+// algorithms taking already built scanners
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blIntegerType>
+
+inline blIntegerType findBeginningOfNthDataPoint(const blDataIteratorType& dataBeginIter,
+                                                 const blDataIteratorType& dataEndIter,
+                                                 const blSIMDTokenScanner& tokenScanner,
+                                                 const bool& shouldZeroLengthRowsBeCounted,
+                                                 const blIntegerType& whichDataPointToFind,
+                                                 blDataIteratorType& nthDataPointBeginIter)
+{
+    return findBeginningOfNthDataPoint(dataBeginIter,
+                                       dataEndIter,
+                                       tokenScanner.getTokens().begin(),
+                                       tokenScanner.getTokens().end(),
+                                       shouldZeroLengthRowsBeCounted,
+                                       whichDataPointToFind,
+                                       nthDataPointBeginIter);
+}
+
+
+
+template<typename blIntegerType>
+
+inline blIntegerType findBeginningOfNthDataPoint(const char* const& dataBeginIter,
+                                                 const char* const& dataEndIter,
+                                                 const blSIMDTokenScanner& tokenScanner,
+                                                 const bool& shouldZeroLengthRowsBeCounted,
+                                                 const blIntegerType& whichDataPointToFind,
+                                                 const char*& nthDataPointBeginIter)
+{
+    return static_cast<blIntegerType>(findBeginningOfNthDataPointInCharBuffer(dataBeginIter,
+                                                                              dataEndIter,
+                                                                              tokenScanner,
+                                                                              nullptr,
+                                                                              shouldZeroLengthRowsBeCounted,
+                                                                              static_cast<std::ptrdiff_t>(whichDataPointToFind),
+                                                                              nthDataPointBeginIter));
+}
+
+
+
+template<typename blIntegerType>
+
+inline blIntegerType findBeginningOfNthDataPoint(char* const& dataBeginIter,
+                                                 char* const& dataEndIter,
+                                                 const blSIMDTokenScanner& tokenScanner,
+                                                 const bool& shouldZeroLengthRowsBeCounted,
+                                                 const blIntegerType& whichDataPointToFind,
+                                                 char*& nthDataPointBeginIter)
+{
+    // We copy the inputs since the
+    // output iterator could be one
+    // of them
+
+    char* beginIter = dataBeginIter;
+
+    const char* constNthDataPointBeginIter = beginIter;
+
+    std::ptrdiff_t dataPointFound = findBeginningOfNthDataPointInCharBuffer(beginIter,
+                                                                            dataEndIter,
+                                                                            tokenScanner,
+                                                                            nullptr,
+                                                                            shouldZeroLengthRowsBeCounted,
+                                                                            static_cast<std::ptrdiff_t>(whichDataPointToFind),
+                                                                            constNthDataPointBeginIter);
+
+    nthDataPointBeginIter = beginIter + (constNthDataPointBeginIter - beginIter);
+
+    return static_cast<blIntegerType>(dataPointFound);
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blIntegerType>
+
+inline blIntegerType findBeginningOfNthDataPointRespectingQuotes(const blDataIteratorType& dataBeginIter,
+                                                                 const blDataIteratorType& dataEndIter,
+                                                                 const blSIMDTokenScanner& tokenScanner,
+                                                                 const bool& shouldZeroLengthRowsBeCounted,
+                                                                 const blSIMDTokenScanner& quoteTokenScanner,
+                                                                 const blIntegerType& whichDataPointToFind,
+                                                                 blDataIteratorType& nthDataPointBeginIter)
+{
+    return findBeginningOfNthDataPointRespectingQuotes(dataBeginIter,
+                                                       dataEndIter,
+                                                       tokenScanner.getTokens().begin(),
+                                                       tokenScanner.getTokens().end(),
+                                                       shouldZeroLengthRowsBeCounted,
+                                                       quoteTokenScanner.getTokens()[0],
+                                                       whichDataPointToFind,
+                                                       nthDataPointBeginIter);
+}
+
+
+
+template<typename blIntegerType>
+
+inline blIntegerType findBeginningOfNthDataPointRespectingQuotes(const char* const& dataBeginIter,
+                                                                 const char* const& dataEndIter,
+                                                                 const blSIMDTokenScanner& tokenScanner,
+                                                                 const bool& shouldZeroLengthRowsBeCounted,
+                                                                 const blSIMDTokenScanner& quoteTokenScanner,
+                                                                 const blIntegerType& whichDataPointToFind,
+                                                                 const char*& nthDataPointBeginIter)
+{
+    return static_cast<blIntegerType>(findBeginningOfNthDataPointInCharBuffer(dataBeginIter,
+                                                                              dataEndIter,
+                                                                              tokenScanner,
+                                                                              &quoteTokenScanner,
+                                                                              shouldZeroLengthRowsBeCounted,
+                                                                              static_cast<std::ptrdiff_t>(whichDataPointToFind),
+                                                                              nthDataPointBeginIter));
+}
+
+
+
+template<typename blIntegerType>
+
+inline blIntegerType findBeginningOfNthDataPointRespectingQuotes(char* const& dataBeginIter,
+                                                                 char* const& dataEndIter,
+                                                                 const blSIMDTokenScanner& tokenScanner,
+                                                                 const bool& shouldZeroLengthRowsBeCounted,
+                                                                 const blSIMDTokenScanner& quoteTokenScanner,
+                                                                 const blIntegerType& whichDataPointToFind,
+                                                                 char*& nthDataPointBeginIter)
+{
+    char* beginIter = dataBeginIter;
+
+    const char* constNthDataPointBeginIter = beginIter;
+
+    std::ptrdiff_t dataPointFound = findBeginningOfNthDataPointInCharBuffer(beginIter,
+                                                                            dataEndIter,
+                                                                            tokenScanner,
+                                                                            &quoteTokenScanner,
+                                                                            shouldZeroLengthRowsBeCounted,
+                                                                            static_cast<std::ptrdiff_t>(whichDataPointToFind),
+                                                                            constNthDataPointBeginIter);
+
+    nthDataPointBeginIter = beginIter + (constNthDataPointBeginIter - beginIter);
+
+    return static_cast<blIntegerType>(dataPointFound);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// End of namespace
+}
+//-------------------------------------------------------------------
+
+
+
+#endif // BL_SIMDTOKENSCANNER_HPP
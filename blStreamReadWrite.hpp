@@ -30,6 +30,18 @@
 
 
 
+//-------------------------------------------------------------------
+// Includes needed for this file
+//-------------------------------------------------------------------
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <ios>
+//-------------------------------------------------------------------
+
+
+
 //-------------------------------------------------------------------
 // NOTE: This class is defined within the blAlgorithmsLIB namespace
 //-------------------------------------------------------------------
@@ -124,6 +136,98 @@ inline blOutputStreamType& writeBuffer(blOutputStreamType& os,const blBufferType
 
 
 
+//-------------------------------------------------------------------
+// The following functions write/read a buffer preceded by
+// its length (number of elements, as a 64 bit integer), so
+// that it can be read back without knowing its length
+//
+// -- The buffer also defines the "resize" function and
+//    the [] operator
+//
+// -- When reading, a buffer longer than the specified
+//    maximum length is treated as an error (the stream's
+//    failbit is set and the buffer is left empty), this
+//    protects against corrupted or foreign data
+//-------------------------------------------------------------------
+template<typename blOutputStreamType,
+         typename blBufferType>
+
+inline blOutputStreamType& writeSizedBuffer(blOutputStreamType& os,const blBufferType& buffer)
+{
+    writeValue(os,static_cast<std::uint64_t>(buffer.size()));
+
+    if(buffer.size() > 0)
+        writeBuffer(os,buffer);
+
+    return os;
+}
+
+
+
+template<typename blInputStreamType,
+         typename blBufferType>
+
+inline blInputStreamType& readSizedBuffer(blInputStreamType& is,blBufferType& buffer,const std::uint64_t& maximumBufferLength)
+{
+    std::uint64_t bufferLength = 0;
+
+    readValue(is,bufferLength);
+
+    buffer.resize(0);
+
+    if(!is)
+        return is;
+
+    if(bufferLength > maximumBufferLength)
+    {
+        is.setstate(std::ios::failbit);
+        return is;
+    }
+
+    buffer.resize(static_cast<std::size_t>(bufferLength));
+
+    // NOTE:  We don't use "data" here since
+    //        it is const for strings before
+    //        c++17
+
+    if(bufferLength > 0)
+        is.read(reinterpret_cast<char*>(&buffer[0]),sizeof(buffer[0])*buffer.size());
+
+    return is;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// The following function replaces a file with a temporary
+// file that was fully written, so that a reader of the file
+// never sees it half written
+//
+// -- The temporary file is removed if the renaming fails
+//
+// NOTE:  Renaming onto an existing file fails on windows,
+//        so there we remove the old one first
+//-------------------------------------------------------------------
+inline bool replaceFileWithTemporaryFile(const std::string& filePath,
+                                         const std::string& temporaryFilePath)
+{
+#if defined(_WIN32)
+    std::remove(filePath.c_str());
+#endif
+
+    if(std::rename(temporaryFilePath.c_str(),filePath.c_str()) != 0)
+    {
+        std::remove(temporaryFilePath.c_str());
+        return false;
+    }
+
+    return true;
+}
+//-------------------------------------------------------------------
+
+
+
 //-------------------------------------------------------------------
 // The following function does buffered reading/writing from an input
 // stream to an output stream.
@@ -20,6 +20,28 @@
 //                     each row is separated by the '\n' newline
 //                     token
 //
+//                  -- The iterator can optionally build a line index (the
+//                     offset of the beginning of each line), so that moving
+//                     to any line does not require scanning the text data
+//                     The line index is shared between copies of the
+//                     iterator
+//
+//                  -- The line index can be saved to an index file (for
+//                     ex. a ".blidx" file) together with a fingerprint of
+//                     the text data, so that the next time the same text
+//                     data is opened the index is loaded instead of
+//                     scanning the text data (the fingerprint hashes every
+//                     byte of the text data, so any change to it
+//                     invalidates the index)
+//
+//                  -- Each line is converted into a number by a conversion
+//                     policy, a template parameter that defaults to
+//                     blDefaultNumberConverter and is resolved at compile time
+//
+//                  -- The next N lines can be read in one call, which walks
+//                     the text data (or the line index) forward line by line
+//                     without going through the arithmetic operators
+//
 //                  -- This class and its functions are defined within
 //                     the "blAlgorithmsLIB" namespace
 //
@@ -41,6 +63,17 @@
 // Includes needed for this file
 //-------------------------------------------------------------------
 #include <iterator>
+#include <string>
+#include <vector>
+#include <memory>
+#include <fstream>
+#include <cstdio>
+#include <cstdint>
+#include <algorithm>
+
+#include "blConvertToNumber.hpp"
+#include "blStreamReadWrite.hpp"
+#include "blDataFingerprint.hpp"
 //-------------------------------------------------------------------
 
 
@@ -56,7 +89,8 @@ namespace blAlgorithmsLIB
 
 //-------------------------------------------------------------------
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType = blDefaultNumberConverter>
 
 class blTextColumnVectorIterator
 {
@@ -83,15 +117,21 @@ public: // Constructors and destructor
 
 
     // Constructor from two iterators
+    // When an index file is specified, the
+    // line index is loaded from it if it
+    // matches the text data, otherwise the
+    // line index is built and the index
+    // file is (re)written
 
     blTextColumnVectorIterator(const blDataIteratorType& beginIter,
-                               const blDataIteratorType& endIter);
+                               const blDataIteratorType& endIter,
+                               const std::string& indexFilePath = std::string());
 
 
 
     // Default copy constructor
 
-    blTextColumnVectorIterator(const blTextColumnVectorIterator<blDataIteratorType,blNumberType>& textColumnVectorIterator) = default;
+    blTextColumnVectorIterator(const blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>& textColumnVectorIterator) = default;
 
 
 
@@ -107,7 +147,7 @@ public: // Assignment operators
 
     // Default assignment operator
 
-    blTextColumnVectorIterator<blDataIteratorType,blNumberType>&        operator=(const blTextColumnVectorIterator<blDataIteratorType,blNumberType>& textColumnVectorIterator) = default;
+    blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>&  operator=(const blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>& textColumnVectorIterator) = default;
 
 
 
@@ -128,8 +168,8 @@ public: // Comparison operators
 
 
 
-    bool                                                                operator==(const blTextColumnVectorIterator<blDataIteratorType,blNumberType>& stringColumnVectorIterator)const;
-    bool                                                                operator!=(const blTextColumnVectorIterator<blDataIteratorType,blNumberType>& stringColumnVectorIterator)const;
+    bool                                                                operator==(const blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>& stringColumnVectorIterator)const;
+    bool                                                                operator!=(const blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>& stringColumnVectorIterator)const;
 
 
 
@@ -156,14 +196,14 @@ public: // Arithmetic operators
 
 
 
-    blTextColumnVectorIterator<blDataIteratorType,blNumberType>&        operator+=(const std::ptrdiff_t& movement);
-    blTextColumnVectorIterator<blDataIteratorType,blNumberType>&        operator-=(const std::ptrdiff_t& movement);
-    blTextColumnVectorIterator<blDataIteratorType,blNumberType>&        operator++();
-    blTextColumnVectorIterator<blDataIteratorType,blNumberType>&        operator--();
-    blTextColumnVectorIterator<blDataIteratorType,blNumberType>         operator++(int);
-    blTextColumnVectorIterator<blDataIteratorType,blNumberType>         operator--(int);
-    blTextColumnVectorIterator<blDataIteratorType,blNumberType>         operator+(const std::ptrdiff_t& movement)const;
-    blTextColumnVectorIterator<blDataIteratorType,blNumberType>         operator-(const std::ptrdiff_t& movement)const;
+    blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>&  operator+=(const std::ptrdiff_t& movement);
+    blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>&  operator-=(const std::ptrdiff_t& movement);
+    blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>&  operator++();
+    blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>&  operator--();
+    blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>   operator++(int);
+    blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>   operator--(int);
+    blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>   operator+(const std::ptrdiff_t& movement)const;
+    blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>   operator-(const std::ptrdiff_t& movement)const;
 
 
 
@@ -171,7 +211,7 @@ public: // Arithmetic operators
     // two pointers (it gives the
     // distance)
 
-    std::ptrdiff_t                                                      operator-(const blTextColumnVectorIterator<blDataIteratorType,blNumberType>& stringColumnVectorIterator)const;
+    std::ptrdiff_t                                                      operator-(const blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>& stringColumnVectorIterator)const;
 
 
 
@@ -183,7 +223,8 @@ public: // Public functions
     // set the data iterators
 
     void                                                                setIterators(const blDataIteratorType& beginIter,
-                                                                                     const blDataIteratorType& endIter);
+                                                                                     const blDataIteratorType& endIter,
+                                                                                     const std::string& indexFilePath = std::string());
 
 
 
@@ -195,6 +236,31 @@ public: // Public functions
 
 
 
+    // Function used to build the line
+    // index, which also counts the rows
+
+    const int&                                                          buildLineIndex();
+
+    bool                                                                isLineIndexBuilt()const;
+
+
+
+    // Functions used to save the line index
+    // to an index file and to load it back
+    // The index also holds the length and
+    // fingerprint of the text data, loading
+    // fails (returning false and leaving the
+    // iterator unchanged) when they don't
+    // match
+
+    bool                                                                saveIndex(std::ostream& outputStream)const;
+    bool                                                                saveIndex(const std::string& indexFilePath)const;
+
+    bool                                                                loadIndex(std::istream& inputStream);
+    bool                                                                loadIndex(const std::string& indexFilePath);
+
+
+
     // Functions used to get this class' members
 
     const int&                                                          getCurrentLine()const;
@@ -206,6 +272,29 @@ public: // Public functions
 
 
 
+    // Functions used to set/get the policy
+    // used to convert the lines into numbers
+    // (setting it converts the current line
+    // again)
+
+    void                                                                setNumberConverter(const blNumberConverterType& numberConverter);
+    const blNumberConverterType&                                        getNumberConverter()const;
+
+
+
+    // Function used to read the next lines
+    // (starting with the current one) as
+    // numbers into the output iterator and
+    // to move the iterator past them
+    // It stops at the end of the text data
+    // and returns the number of values read
+
+    template<typename blOutputIteratorType>
+    std::size_t                                                         fill(blOutputIteratorType outputIter,
+                                                                             const std::size_t& numberOfValues);
+
+
+
 private: // Private functions
 
 
@@ -218,6 +307,19 @@ private: // Private functions
 
 
 
+private: // Static functions/variables/constants
+
+
+
+    // Tag ("BLTXTIDX" read as a little
+    // endian integer) and version written
+    // at the beginning of an index
+
+    const static std::uint64_t                                          s_indexTag;
+    const static std::uint64_t                                          s_indexVersion;
+
+
+
 protected: // Protected variables
 
 
@@ -247,6 +349,13 @@ protected: // Protected variables
 
 
 
+    // The policy used to convert
+    // the lines into numbers
+
+    blNumberConverterType                                               m_numberConverter;
+
+
+
     //  Current line in the buffer
 
     int                                                                 m_currentLine;
@@ -256,31 +365,53 @@ protected: // Protected variables
     // Total number of data rows
 
     int                                                                 m_totalNumberOfLines;
+
+
+
+    // Line index (offset of the
+    // beginning of each line), empty
+    // when not built
+
+    std::shared_ptr<const std::vector<std::ptrdiff_t>>                  m_lineOffsets;
 };
 //-------------------------------------------------------------------
 
 
 
 //-------------------------------------------------------------------
-// Constructor from two iterators
+// Static constants definitions
 //-------------------------------------------------------------------
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline blTextColumnVectorIterator<blDataIteratorType,blNumberType>::blTextColumnVectorIterator(const blDataIteratorType& beginIter,
-                                                                                               const blDataIteratorType& endIter)
-{
-    m_beginIter = beginIter;
-    m_endIter = endIter;
-    m_iter = m_beginIter;
+const std::uint64_t blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>::s_indexTag = 0x5844495458544C42ull;
 
-    m_number = 0;
 
-    m_currentLine = 0;
 
-    calculateTotalNumberOfRows();
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
 
-    convertToNumberFromCurrentPosition();
+const std::uint64_t blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>::s_indexVersion = 2;
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Constructor from two iterators
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>::blTextColumnVectorIterator(const blDataIteratorType& beginIter,
+                                                                                                                     const blDataIteratorType& endIter,
+                                                                                                                     const std::string& indexFilePath)
+{
+    setIterators(beginIter,
+                 endIter,
+                 indexFilePath);
 }
 //-------------------------------------------------------------------
 
@@ -290,9 +421,10 @@ inline blTextColumnVectorIterator<blDataIteratorType,blNumberType>::blTextColumn
 // Destructor
 //-------------------------------------------------------------------
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline blTextColumnVectorIterator<blDataIteratorType,blNumberType>::~blTextColumnVectorIterator()
+inline blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>::~blTextColumnVectorIterator()
 {
 }
 //-------------------------------------------------------------------
@@ -303,9 +435,10 @@ inline blTextColumnVectorIterator<blDataIteratorType,blNumberType>::~blTextColum
 // Comparison operators
 //-------------------------------------------------------------------
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline bool blTextColumnVectorIterator<blDataIteratorType,blNumberType>::operator==(const blTextColumnVectorIterator<blDataIteratorType,blNumberType>& textMatrixIterator)const
+inline bool blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>::operator==(const blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>& textMatrixIterator)const
 {
     return (m_iter == textMatrixIterator.getIter());
 }
@@ -313,9 +446,10 @@ inline bool blTextColumnVectorIterator<blDataIteratorType,blNumberType>::operato
 
 
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline bool blTextColumnVectorIterator<blDataIteratorType,blNumberType>::operator!=(const blTextColumnVectorIterator<blDataIteratorType,blNumberType>& textMatrixIterator)const
+inline bool blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>::operator!=(const blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>& textMatrixIterator)const
 {
     return (m_iter != textMatrixIterator.getIter());
 }
@@ -327,9 +461,10 @@ inline bool blTextColumnVectorIterator<blDataIteratorType,blNumberType>::operato
 // Access operators and functions
 //-------------------------------------------------------------------
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline const blNumberType& blTextColumnVectorIterator<blDataIteratorType,blNumberType>::operator[](const std::ptrdiff_t& index)
+inline const blNumberType& blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>::operator[](const std::ptrdiff_t& index)
 {
     (*this) += index - m_currentLine;
     return m_number;
@@ -338,9 +473,10 @@ inline const blNumberType& blTextColumnVectorIterator<blDataIteratorType,blNumbe
 
 
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline const blNumberType& blTextColumnVectorIterator<blDataIteratorType,blNumberType>::operator()(const std::ptrdiff_t& index)
+inline const blNumberType& blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>::operator()(const std::ptrdiff_t& index)
 {
     (*this) += index - m_currentLine;
     return m_number;
@@ -349,9 +485,10 @@ inline const blNumberType& blTextColumnVectorIterator<blDataIteratorType,blNumbe
 
 
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline const blNumberType& blTextColumnVectorIterator<blDataIteratorType,blNumberType>::at(const std::ptrdiff_t& index)
+inline const blNumberType& blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>::at(const std::ptrdiff_t& index)
 {
     (*this) += index - m_currentLine;
     return m_number;
@@ -364,9 +501,10 @@ inline const blNumberType& blTextColumnVectorIterator<blDataIteratorType,blNumbe
 // Reference and Dereference operators
 //-------------------------------------------------------------------
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline blNumberType* blTextColumnVectorIterator<blDataIteratorType,blNumberType>::operator->()
+inline blNumberType* blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>::operator->()
 {
     return &m_number;
 }
@@ -374,9 +512,10 @@ inline blNumberType* blTextColumnVectorIterator<blDataIteratorType,blNumberType>
 
 
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline const blNumberType& blTextColumnVectorIterator<blDataIteratorType,blNumberType>::operator*()const
+inline const blNumberType& blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>::operator*()const
 {
     return m_number;
 }
@@ -388,11 +527,38 @@ inline const blNumberType& blTextColumnVectorIterator<blDataIteratorType,blNumbe
 // += arithmetic operator
 //-------------------------------------------------------------------
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline blTextColumnVectorIterator<blDataIteratorType,blNumberType>& blTextColumnVectorIterator<blDataIteratorType,blNumberType>::operator+=(const std::ptrdiff_t& movement)
+inline blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>& blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>::operator+=(const std::ptrdiff_t& movement)
 {
-    if(movement > 0)
+    // With a line index we
+    // jump straight to the line
+
+    if(m_lineOffsets && movement != 0)
+    {
+        std::ptrdiff_t newLine = m_currentLine + movement;
+
+        if(newLine < 0)
+        {
+            m_currentLine = 0;
+            m_iter = m_beginIter;
+        }
+        else if(newLine >= m_totalNumberOfLines)
+        {
+            m_currentLine = m_totalNumberOfLines;
+            m_iter = m_endIter;
+        }
+        else
+        {
+            m_currentLine = static_cast<int>(newLine);
+            m_iter = m_beginIter;
+            std::advance(m_iter,(*m_lineOffsets)[newLine]);
+        }
+
+        convertToNumberFromCurrentPosition();
+    }
+    else if(movement > 0)
     {
         int actualMovement = findBeginningOfNthDataRow(m_iter,m_endIter,'\n',false,movement,m_iter);
 
@@ -436,9 +602,10 @@ inline blTextColumnVectorIterator<blDataIteratorType,blNumberType>& blTextColumn
 // All other arithmetic operators that use the += operator
 //-------------------------------------------------------------------
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline blTextColumnVectorIterator<blDataIteratorType,blNumberType>& blTextColumnVectorIterator<blDataIteratorType,blNumberType>::operator-=(const std::ptrdiff_t& movement)
+inline blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>& blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>::operator-=(const std::ptrdiff_t& movement)
 {
     return this->operator+=(-movement);
 }
@@ -446,9 +613,10 @@ inline blTextColumnVectorIterator<blDataIteratorType,blNumberType>& blTextColumn
 
 
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline blTextColumnVectorIterator<blDataIteratorType,blNumberType>& blTextColumnVectorIterator<blDataIteratorType,blNumberType>::operator++()
+inline blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>& blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>::operator++()
 {
     return this->operator+=(1);
 }
@@ -456,9 +624,10 @@ inline blTextColumnVectorIterator<blDataIteratorType,blNumberType>& blTextColumn
 
 
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline blTextColumnVectorIterator<blDataIteratorType,blNumberType>& blTextColumnVectorIterator<blDataIteratorType,blNumberType>::operator--()
+inline blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>& blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>::operator--()
 {
     return this->operator+=(-1);
 }
@@ -466,9 +635,10 @@ inline blTextColumnVectorIterator<blDataIteratorType,blNumberType>& blTextColumn
 
 
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline blTextColumnVectorIterator<blDataIteratorType,blNumberType> blTextColumnVectorIterator<blDataIteratorType,blNumberType>::operator++(int)
+inline blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType> blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>::operator++(int)
 {
     auto temp(*this);
 
@@ -480,9 +650,10 @@ inline blTextColumnVectorIterator<blDataIteratorType,blNumberType> blTextColumnV
 
 
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline blTextColumnVectorIterator<blDataIteratorType,blNumberType> blTextColumnVectorIterator<blDataIteratorType,blNumberType>::operator--(int)
+inline blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType> blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>::operator--(int)
 {
     auto temp(*this);
 
@@ -494,9 +665,10 @@ inline blTextColumnVectorIterator<blDataIteratorType,blNumberType> blTextColumnV
 
 
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline blTextColumnVectorIterator<blDataIteratorType,blNumberType> blTextColumnVectorIterator<blDataIteratorType,blNumberType>::operator+(const std::ptrdiff_t& movement)const
+inline blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType> blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>::operator+(const std::ptrdiff_t& movement)const
 {
     auto temp(*this);
 
@@ -508,9 +680,10 @@ inline blTextColumnVectorIterator<blDataIteratorType,blNumberType> blTextColumnV
 
 
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline blTextColumnVectorIterator<blDataIteratorType,blNumberType> blTextColumnVectorIterator<blDataIteratorType,blNumberType>::operator-(const std::ptrdiff_t& movement)const
+inline blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType> blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>::operator-(const std::ptrdiff_t& movement)const
 {
     auto temp(*this);
 
@@ -527,9 +700,10 @@ inline blTextColumnVectorIterator<blDataIteratorType,blNumberType> blTextColumnV
 // (it returns the distance between the iterators)
 //-------------------------------------------------------------------
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline std::ptrdiff_t blTextColumnVectorIterator<blDataIteratorType,blNumberType>::operator-(const blTextColumnVectorIterator<blDataIteratorType,blNumberType>& stringColumnVectorIterator)const
+inline std::ptrdiff_t blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>::operator-(const blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>& stringColumnVectorIterator)const
 {
     return (m_iter - stringColumnVectorIterator.getIter());
 }
@@ -541,10 +715,12 @@ inline std::ptrdiff_t blTextColumnVectorIterator<blDataIteratorType,blNumberType
 // Function used to manually set the data iterators
 //-------------------------------------------------------------------
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline void blTextColumnVectorIterator<blDataIteratorType,blNumberType>::setIterators(const blDataIteratorType& beginIter,
-                                                                                const blDataIteratorType& endIter)
+inline void blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>::setIterators(const blDataIteratorType& beginIter,
+                                                                                const blDataIteratorType& endIter,
+                                                                                const std::string& indexFilePath)
 {
     m_beginIter = beginIter;
     m_endIter = endIter;
@@ -554,7 +730,25 @@ inline void blTextColumnVectorIterator<blDataIteratorType,blNumberType>::setIter
 
     m_currentLine = 0;
 
-    calculateTotalNumberOfRows();
+    m_lineOffsets.reset();
+
+
+
+    // When an index file is used, we
+    // try loading the line index from it
+    // and only build it (and rewrite the
+    // index file) if that fails
+
+    if(indexFilePath.empty())
+    {
+        calculateTotalNumberOfRows();
+    }
+    else if(!loadIndex(indexFilePath))
+    {
+        buildLineIndex();
+
+        saveIndex(indexFilePath);
+    }
 
     convertToNumberFromCurrentPosition();
 }
@@ -567,9 +761,10 @@ inline void blTextColumnVectorIterator<blDataIteratorType,blNumberType>::setIter
 // in the provided serialized data
 //-------------------------------------------------------------------
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline const int& blTextColumnVectorIterator<blDataIteratorType,blNumberType>::calculateTotalNumberOfRows()
+inline const int& blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>::calculateTotalNumberOfRows()
 {
     m_totalNumberOfLines = blAlgorithmsLIB::countDataRows(m_beginIter,
                                                           m_endIter,
@@ -582,13 +777,191 @@ inline const int& blTextColumnVectorIterator<blDataIteratorType,blNumberType>::c
 
 
 
+//-------------------------------------------------------------------
+// Function used to build the line index
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline const int& blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>::buildLineIndex()
+{
+    const char lineToken = '\n';
+
+    auto lineOffsets = std::make_shared<std::vector<std::ptrdiff_t>>();
+
+    m_totalNumberOfLines = static_cast<int>(blAlgorithmsLIB::findOffsetsOfAllDataRows(m_beginIter,
+                                                                                      m_endIter,
+                                                                                      &lineToken,
+                                                                                      &lineToken + 1,
+                                                                                      false,
+                                                                                      m_beginIter,
+                                                                                      *lineOffsets));
+
+    m_lineOffsets = std::move(lineOffsets);
+
+    return m_totalNumberOfLines;
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline bool blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>::isLineIndexBuilt()const
+{
+    return static_cast<bool>(m_lineOffsets);
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Functions used to save/load the line index
+// to/from an index
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline bool blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>::saveIndex(std::ostream& outputStream)const
+{
+    if(!m_lineOffsets)
+        return false;
+
+    std::vector<std::int64_t> lineOffsets(m_lineOffsets->begin(),m_lineOffsets->end());
+
+    writeValue(outputStream,s_indexTag);
+    writeValue(outputStream,s_indexVersion);
+    writeValue(outputStream,static_cast<std::uint64_t>(std::distance(m_beginIter,m_endIter)));
+    writeValue(outputStream,computeFullDataFingerprint(m_beginIter,m_endIter));
+
+    writeSizedBuffer(outputStream,lineOffsets);
+
+    return static_cast<bool>(outputStream);
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline bool blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>::saveIndex(const std::string& indexFilePath)const
+{
+    // We write to a temporary file
+    // and then rename it, so that the
+    // index file is never seen half
+    // written
+
+    std::string temporaryFilePath = indexFilePath + ".tmp";
+
+    {
+        std::ofstream indexFile(temporaryFilePath,std::ios::binary | std::ios::trunc);
+
+        if(!indexFile)
+            return false;
+
+        if(!saveIndex(indexFile))
+        {
+            indexFile.close();
+            std::remove(temporaryFilePath.c_str());
+            return false;
+        }
+    }
+
+    return replaceFileWithTemporaryFile(indexFilePath,temporaryFilePath);
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline bool blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>::loadIndex(std::istream& inputStream)
+{
+    std::ptrdiff_t dataLength = std::distance(m_beginIter,m_endIter);
+
+    std::uint64_t indexTag = 0;
+    std::uint64_t indexVersion = 0;
+    std::uint64_t indexedDataLength = 0;
+    std::uint64_t indexedDataFingerprint = 0;
+
+    readValue(inputStream,indexTag);
+    readValue(inputStream,indexVersion);
+    readValue(inputStream,indexedDataLength);
+    readValue(inputStream,indexedDataFingerprint);
+
+    if(!inputStream ||
+       indexTag != s_indexTag ||
+       indexVersion != s_indexVersion ||
+       indexedDataLength != static_cast<std::uint64_t>(dataLength) ||
+       indexedDataFingerprint != computeFullDataFingerprint(m_beginIter,m_endIter))
+    {
+        return false;
+    }
+
+
+
+    // A corrupted index must not make
+    // the iterator point outside of
+    // the data
+
+    std::vector<std::int64_t> lineOffsets;
+
+    readSizedBuffer(inputStream,lineOffsets,indexedDataLength);
+
+    auto isOffsetValid = [dataLength](const std::int64_t& offset)
+    {
+        return offset >= 0 && offset < dataLength;
+    };
+
+    if(!inputStream || !std::all_of(lineOffsets.begin(),lineOffsets.end(),isOffsetValid))
+        return false;
+
+
+
+    m_lineOffsets = std::make_shared<std::vector<std::ptrdiff_t>>(lineOffsets.begin(),lineOffsets.end());
+
+    m_totalNumberOfLines = static_cast<int>(lineOffsets.size());
+
+    m_currentLine = 0;
+    m_iter = m_beginIter;
+
+    convertToNumberFromCurrentPosition();
+
+    return true;
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline bool blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>::loadIndex(const std::string& indexFilePath)
+{
+    std::ifstream indexFile(indexFilePath,std::ios::binary);
+
+    if(!indexFile)
+        return false;
+
+    return loadIndex(indexFile);
+}
+//-------------------------------------------------------------------
+
+
+
 //-------------------------------------------------------------------
 // Functions used to get the class' members
 //-------------------------------------------------------------------
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline const int& blTextColumnVectorIterator<blDataIteratorType,blNumberType>::getCurrentLine()const
+inline const int& blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>::getCurrentLine()const
 {
     return m_currentLine;
 }
@@ -596,9 +969,10 @@ inline const int& blTextColumnVectorIterator<blDataIteratorType,blNumberType>::g
 
 
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline const blDataIteratorType& blTextColumnVectorIterator<blDataIteratorType,blNumberType>::getBeginIter()const
+inline const blDataIteratorType& blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>::getBeginIter()const
 {
     return m_beginIter;
 }
@@ -606,9 +980,10 @@ inline const blDataIteratorType& blTextColumnVectorIterator<blDataIteratorType,b
 
 
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline const blDataIteratorType& blTextColumnVectorIterator<blDataIteratorType,blNumberType>::getEndIter()const
+inline const blDataIteratorType& blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>::getEndIter()const
 {
     return m_endIter;
 }
@@ -616,9 +991,10 @@ inline const blDataIteratorType& blTextColumnVectorIterator<blDataIteratorType,b
 
 
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline const blDataIteratorType& blTextColumnVectorIterator<blDataIteratorType,blNumberType>::getIter()const
+inline const blDataIteratorType& blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>::getIter()const
 {
     return m_iter;
 }
@@ -626,9 +1002,10 @@ inline const blDataIteratorType& blTextColumnVectorIterator<blDataIteratorType,b
 
 
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline const blNumberType& blTextColumnVectorIterator<blDataIteratorType,blNumberType>::getNumber()const
+inline const blNumberType& blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>::getNumber()const
 {
     return m_number;
 }
@@ -636,9 +1013,10 @@ inline const blNumberType& blTextColumnVectorIterator<blDataIteratorType,blNumbe
 
 
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline const int& blTextColumnVectorIterator<blDataIteratorType,blNumberType>::getTotalNumberOfLines()const
+inline const int& blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>::getTotalNumberOfLines()const
 {
     return m_totalNumberOfLines;
 }
@@ -646,6 +1024,97 @@ inline const int& blTextColumnVectorIterator<blDataIteratorType,blNumberType>::g
 
 
 
+//-------------------------------------------------------------------
+// Functions used to set/get the number converter
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline void blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>::setNumberConverter(const blNumberConverterType& numberConverter)
+{
+    m_numberConverter = numberConverter;
+
+    convertToNumberFromCurrentPosition();
+}
+
+
+
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+inline const blNumberConverterType& blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>::getNumberConverter()const
+{
+    return m_numberConverter;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Function used to read the next lines in one call
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType,
+         typename blNumberConverterType>
+
+template<typename blOutputIteratorType>
+
+inline std::size_t blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>::fill(blOutputIteratorType outputIter,
+                                                                                                           const std::size_t& numberOfValues)
+{
+    std::size_t numberOfValuesRead = 0;
+
+    while(numberOfValuesRead < numberOfValues && m_iter != m_endIter)
+    {
+        // The current line is
+        // already converted
+
+        (*outputIter) = m_number;
+        ++outputIter;
+        ++numberOfValuesRead;
+
+
+
+        // We then step to the next
+        // line, with the line index
+        // we jump to it straight from
+        // the current one
+
+        if(m_lineOffsets)
+        {
+            ++m_currentLine;
+
+            if(m_currentLine >= m_totalNumberOfLines)
+            {
+                m_currentLine = m_totalNumberOfLines;
+                m_iter = m_endIter;
+            }
+            else
+            {
+                std::advance(m_iter,(*m_lineOffsets)[m_currentLine] - (*m_lineOffsets)[m_currentLine - 1]);
+            }
+        }
+        else
+        {
+            int actualMovement = findBeginningOfNthDataRow(m_iter,m_endIter,'\n',false,1,m_iter);
+
+            if(actualMovement < 1)
+                m_iter = m_endIter;
+
+            m_currentLine += actualMovement;
+        }
+
+        convertToNumberFromCurrentPosition();
+    }
+
+    return numberOfValuesRead;
+}
+//-------------------------------------------------------------------
+
+
+
 //-------------------------------------------------------------------
 // Function used to convert the text we're currently
 // pointing to into a number, this function is called
@@ -653,11 +1122,12 @@ inline const int& blTextColumnVectorIterator<blDataIteratorType,blNumberType>::g
 // location in the text
 //-------------------------------------------------------------------
 template<typename blDataIteratorType,
-         typename blNumberType>
+         typename blNumberType,
+         typename blNumberConverterType>
 
-inline void blTextColumnVectorIterator<blDataIteratorType,blNumberType>::convertToNumberFromCurrentPosition()
+inline void blTextColumnVectorIterator<blDataIteratorType,blNumberType,blNumberConverterType>::convertToNumberFromCurrentPosition()
 {
-    convertToNumber(m_iter,m_endIter,'.',m_number,0);
+    m_numberConverter(m_iter,m_endIter,m_number);
 }
 //-------------------------------------------------------------------
 
@@ -48,6 +48,10 @@
 //                     as text as a single column of values separated
 //                     by a '\n' newline character
 //
+//                  -- The next N values (in row-major order) can be read
+//                     in one call, which steps from one value to the next
+//                     without recomputing the row and column every time
+//
 //                  -- This class and its functions are defined within
 //                     the "blAlgorithmsLIB" namespace
 //
@@ -199,6 +203,23 @@ public: // Public functions
 
 
 
+    // Function used to read the next values
+    // (starting with the current one) in
+    // row-major order into the output
+    // iterator and to move the iterator
+    // past them
+    // It builds the line index (if it's not
+    // built yet), so that each value is
+    // found straight from its row and column
+    // It stops at the end of the data and
+    // returns the number of values read
+
+    template<typename blOutputIteratorType>
+    std::size_t                     fill(blOutputIteratorType outputIter,
+                                         const std::size_t& numberOfValues);
+
+
+
 protected: // Protected variables
 
 
@@ -600,6 +621,100 @@ inline const int& blTextMatrixIterator<blDataIteratorType,blNumberType>::getTota
 
 
 
+//-------------------------------------------------------------------
+// Function used to read the next values in
+// row-major order in one call
+//-------------------------------------------------------------------
+template<typename blDataIteratorType,
+         typename blNumberType>
+
+template<typename blOutputIteratorType>
+
+inline std::size_t blTextMatrixIterator<blDataIteratorType,blNumberType>::fill(blOutputIteratorType outputIter,
+                                                                               const std::size_t& numberOfValues)
+{
+    if(m_rows <= 0 ||
+       this->m_iter == this->m_endIter)
+    {
+        return 0;
+    }
+
+
+
+    // We get the current row and column
+    // from the current line (the cached
+    // ones are only updated by "at"), when
+    // pointing to the header we start from
+    // the first data point
+
+    int dataLine = this->m_currentLine - 3;
+
+    if(dataLine < 0)
+    {
+        blTextColumnVectorIterator<blDataIteratorType,blNumberType>::at(3);
+        dataLine = 0;
+    }
+
+    int row = dataLine % m_rows;
+    int col = dataLine / m_rows;
+
+    if(col >= m_totalNumberOfDataPointsPerRow ||
+       this->m_iter == this->m_endIter)
+    {
+        return 0;
+    }
+
+
+
+    // The data is stored one column after
+    // the other, so the next value in a row
+    // is m_rows lines further down, and the
+    // next row starts back at the top
+    // With the line index every value is
+    // found straight from its line (without
+    // it each of those jumps would scan all
+    // the lines in between)
+
+    if(!this->isLineIndexBuilt())
+        this->buildLineIndex();
+
+    std::size_t numberOfValuesRead = 0;
+
+    while(numberOfValuesRead < numberOfValues && row < m_rows)
+    {
+        (*outputIter) = this->m_number;
+        ++outputIter;
+        ++numberOfValuesRead;
+
+        ++col;
+
+        if(col == m_totalNumberOfDataPointsPerRow)
+        {
+            col = 0;
+            ++row;
+        }
+
+        if(row < m_rows)
+            blTextColumnVectorIterator<blDataIteratorType,blNumberType>::at(row + m_rows * col + 3);
+    }
+
+
+
+    // When the whole data has been read
+    // we point to the end of the text data
+
+    if(row == m_rows)
+        blTextColumnVectorIterator<blDataIteratorType,blNumberType>::at(this->m_totalNumberOfLines);
+
+    m_currentRow = row;
+    m_currentCol = col;
+
+    return numberOfValuesRead;
+}
+//-------------------------------------------------------------------
+
+
+
 //-------------------------------------------------------------------
 // End of namespace
 }
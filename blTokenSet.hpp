@@ -0,0 +1,264 @@
+#ifndef BL_TOKENSET_HPP
+#define BL_TOKENSET_HPP
+
+
+
+//-------------------------------------------------------------------
+// FILE:            blTokenSet.hpp
+// CLASS:           blTokenSet
+// BASE CLASS:      None
+//
+//
+//
+// PURPOSE:         A set of (byte) tokens stored as a 256-bit membership
+//                  table, built once from a list of tokens, so that
+//                  checking whether a byte is a token is a single table
+//                  lookup no matter how many tokens there are
+//
+//                  -- The file also defines overloads of the "find_first_of"
+//                     and "find_first_not_of" algorithms taking a token set
+//                     instead of a list of tokens, which the token-list
+//                     versions have to search for every byte of the buffer
+//
+//                  -- All functions/algorithms are defined within
+//                     the "blAlgorithmsLIB" namespace
+//
+//
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+//
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// Includes needed for this file
+//-------------------------------------------------------------------
+#include <string>
+#include <cstddef>
+#include <cstdint>
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// NOTE: This class is defined within the blAlgorithmsLIB namespace
+//-------------------------------------------------------------------
+namespace blAlgorithmsLIB
+{
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+class blTokenSet
+{
+public: // Constructors and destructor
+
+
+
+    // Default constructor (an
+    // empty set)
+
+    blTokenSet()
+    {
+        clear();
+    }
+
+
+
+    // Constructors from a
+    // list of tokens
+
+    template<typename blTokenIteratorType>
+
+    blTokenSet(const blTokenIteratorType& tokensBeginIter,
+               const blTokenIteratorType& tokensEndIter)
+    {
+        clear();
+        addTokens(tokensBeginIter,tokensEndIter);
+    }
+
+    blTokenSet(const std::string& tokens)
+    {
+        clear();
+        addTokens(tokens.begin(),tokens.end());
+    }
+
+
+
+public: // Public functions
+
+
+
+    // Function used to empty the set
+
+    void                                                                clear();
+
+
+
+    // Functions used to add
+    // tokens to the set
+
+    void                                                                addToken(const char& token);
+
+    template<typename blTokenIteratorType>
+    void                                                                addTokens(const blTokenIteratorType& tokensBeginIter,
+                                                                                  const blTokenIteratorType& tokensEndIter);
+
+
+
+    // Function used to check
+    // whether a byte is a token
+
+    bool                                                                isToken(const char& character)const;
+
+
+
+protected: // Protected variables
+
+
+
+    // Membership table, one bit
+    // for each of the 256 bytes
+
+    std::uint64_t                                                       m_tokenBits[4];
+};
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+inline void blTokenSet::clear()
+{
+    m_tokenBits[0] = 0;
+    m_tokenBits[1] = 0;
+    m_tokenBits[2] = 0;
+    m_tokenBits[3] = 0;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+inline void blTokenSet::addToken(const char& token)
+{
+    unsigned char byte = static_cast<unsigned char>(token);
+
+    m_tokenBits[byte >> 6] |= (std::uint64_t(1) << (byte & 63));
+}
+
+
+
+template<typename blTokenIteratorType>
+
+inline void blTokenSet::addTokens(const blTokenIteratorType& tokensBeginIter,
+                                  const blTokenIteratorType& tokensEndIter)
+{
+    for(auto tokenIter = tokensBeginIter; tokenIter != tokensEndIter; ++tokenIter)
+        addToken(static_cast<char>(*tokenIter));
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+inline bool blTokenSet::isToken(const char& character)const
+{
+    unsigned char byte = static_cast<unsigned char>(character);
+
+    return ((m_tokenBits[byte >> 6] >> (byte & 63)) & 1) != 0;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// The following function searches a buffer for any of the
+// tokens of a token set and returns an iterator to the
+// location where it found the first matching token
+//-------------------------------------------------------------------
+template<typename blBufferIteratorType>
+
+inline blBufferIteratorType find_first_of(const blBufferIteratorType& bufferBeginIter,
+                                          const blBufferIteratorType& bufferEndIter,
+                                          const blTokenSet& tokenSet,
+                                          const std::ptrdiff_t& numberOfTimesToCycleIfIteratorIsCyclic)
+{
+    blBufferIteratorType bufferCurrentIter = bufferBeginIter;
+
+    std::ptrdiff_t numberOfRepeats = 0;
+
+
+
+    while(bufferCurrentIter != bufferEndIter &&
+          numberOfRepeats <= numberOfTimesToCycleIfIteratorIsCyclic)
+    {
+        if(tokenSet.isToken(static_cast<char>(*bufferCurrentIter)))
+            return bufferCurrentIter;
+
+        ++bufferCurrentIter;
+
+        if(bufferCurrentIter == bufferBeginIter)
+            ++numberOfRepeats;
+    }
+
+
+
+    return bufferEndIter;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// The following function searches a buffer for the first
+// place not matching any of the tokens of a token set
+//-------------------------------------------------------------------
+template<typename blBufferIteratorType>
+
+inline blBufferIteratorType find_first_not_of(const blBufferIteratorType& bufferBeginIter,
+                                              const blBufferIteratorType& bufferEndIter,
+                                              const blTokenSet& tokenSet,
+                                              const std::ptrdiff_t& numberOfTimesToCycleIfIteratorIsCyclic)
+{
+    blBufferIteratorType bufferCurrentIter = bufferBeginIter;
+
+    std::ptrdiff_t numberOfRepeats = 0;
+
+
+
+    while(bufferCurrentIter != bufferEndIter &&
+          numberOfRepeats <= numberOfTimesToCycleIfIteratorIsCyclic)
+    {
+        if(!tokenSet.isToken(static_cast<char>(*bufferCurrentIter)))
+            return bufferCurrentIter;
+
+        ++bufferCurrentIter;
+
+        if(bufferCurrentIter == bufferBeginIter)
+            ++numberOfRepeats;
+    }
+
+
+
+    return bufferEndIter;
+}
+//-------------------------------------------------------------------
+
+
+
+//-------------------------------------------------------------------
+// End of namespace
+}
+//-------------------------------------------------------------------
+
+
+
+#endif // BL_TOKENSET_HPP